@@ -54,6 +54,8 @@ class base
   color::value_type         bg_color_;            // background color
   pen_color_function_type   pen_color_function_;  // function for dynamic pen color
   std::size_t               present_lock_;        // present lock counter, > 0 is locked
+  const std::uint8_t*       gamma_coverage_;      // gamma LUT of text coverage, nullptr = linear
+  const std::uint8_t*       gamma_alpha_;         // gamma LUT of image and shape alpha, nullptr = linear
 
 
 public:
@@ -64,6 +66,8 @@ public:
     , bg_color_(color::black)
     , pen_color_function_(nullptr)
     , present_lock_(0U)
+    , gamma_coverage_(nullptr)
+    , gamma_alpha_(nullptr)
   { }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -124,6 +128,49 @@ public:
   inline virtual color::value_type bg_get_color() const
   { return bg_color_; }
 
+  /**
+   * Set the gamma LUTs of the blend weights of this head, see color::gamma_lut()
+   * The coverage LUT is folded into the coverage to alpha LUT of the text renderer, the alpha LUT is
+   * applied to the alpha of blitted images and pen shapes, so the correction costs one lookup per pixel.
+   * The LUTs must stay valid as long as they are set, a glyph cache must be cleared after changing them
+   * \param coverage_lut LUT of 256 entries for AA text coverage, nullptr for linear blending
+   * \param alpha_lut LUT of 256 entries for image and shape alpha, nullptr for linear blending
+   */
+  inline virtual void gamma_set(const std::uint8_t* coverage_lut, const std::uint8_t* alpha_lut)
+  {
+    gamma_coverage_ = coverage_lut;
+    gamma_alpha_    = alpha_lut;
+  }
+
+  /**
+   * Get the gamma LUT of text coverage
+   * \return LUT, nullptr if the coverage is blended linear
+   */
+  inline const std::uint8_t* gamma_coverage() const
+  { return gamma_coverage_; }
+
+  /**
+   * Gamma correct an image or shape alpha
+   * \param alpha Linear alpha
+   * \return Corrected alpha
+   */
+  inline std::uint8_t gamma_alpha(std::uint8_t alpha) const
+  { return gamma_alpha_ ? gamma_alpha_[alpha] : alpha; }
+
+  /**
+   * Gamma correct the alpha of a span of ARGB colors
+   * \param colors Colors to correct
+   * \param length Count of colors
+   */
+  inline void gamma_alpha(color::value_type* colors, std::uint16_t length) const
+  {
+    if (gamma_alpha_) {
+      for (; length; --length, ++colors) {
+        *colors = color::set_alpha(*colors, gamma_alpha_[color::get_alpha(*colors)]);
+      }
+    }
+  }
+
 
 ///////////////////////////////////////////////////////////////////////////////
 // C O M M O N   F U N C T I O N S
@@ -190,6 +190,24 @@ namespace color {
   inline value_type mix(value_type foregound, value_type backgound, std::uint8_t lum)
   { return (dim(foregound, lum) + dim(backgound, 0xFFU - lum)); }
 
+  /**
+   * Build a gamma LUT of blend weights (coverage or alpha)
+   * The LUT maps a linear weight to lut[w] = 255 * (w / 255) ^ (100 / gamma), so a gamma > 100 raises
+   * (thickens) partial weights, a gamma < 100 lowers (thins) them, 100 is the identity.
+   * The LUT is built with integer math only, build it once and pass it to base::gamma_set()
+   * \param lut LUT of 256 entries to build
+   * \param gamma Gamma in 1/100, e.g. 220 for 2.2
+   */
+  inline void gamma_lut(std::uint8_t* lut, std::uint16_t gamma)
+  {
+    const std::int32_t log255 = util::log2_q16(255U);
+    lut[0] = 0U;
+    for (std::uint16_t w = 1U; w < 256U; ++w) {
+      const std::int32_t e = static_cast<std::int32_t>(static_cast<std::int64_t>(util::log2_q16(w) - log255) * 100 / (gamma ? gamma : 1U));
+      lut[w] = static_cast<std::uint8_t>((255UL * util::exp2_q16(e) + 32768UL) >> 16U);
+    }
+  }
+
   /**
    * Return true if color is opaque
    * \param color Color to test
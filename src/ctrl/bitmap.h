@@ -90,69 +90,24 @@ public:
     // lock output
     head_.present_lock();
 
-    switch (format)
-    {
-      case color::format_L1 :
-        for (std::int16_t y = origin.y, ye = origin.y + height; y < ye; ++y) {
-          std::uint16_t bit = 0U;
-          std::uint8_t  data = *bitmap;
-          for (std::int16_t x = origin.x, xe = origin.x + width; x < xe; ++x) {
-            if ((bit++ & 0x07U) == 0x00U) {
-              data = *bitmap++;
-            }
-            else {
-              data >>= 1U;
-            }
-            if (data & 0x01U) {
-              head_.plot({ x, y });
-            }
+    if (format == color::format_L1) {
+      // monochrome XBM: set bits are rendered as horizontal runs in pen color, cleared bits are transparent
+      const std::size_t stride = color::pixel_kernel<color::format_L1>::stride(width);
+      for (std::int16_t y = origin.y, ye = origin.y + height; y < ye; ++y, bitmap += stride) {
+        for (std::uint16_t x = 0U; x < width; ) {
+          if (!color::pixel_kernel<color::format_L1>::read(bitmap, x)) {
+            ++x;
+            continue;
           }
+          const std::uint16_t xs = x;
+          while (++x < width && color::pixel_kernel<color::format_L1>::read(bitmap, x)) { }
+          head_.line_horz({ static_cast<std::int16_t>(origin.x + xs), y }, { static_cast<std::int16_t>(origin.x + x - 1), y });
         }
-        break;
-
-      case color::format_RGB332 :
-        for (std::int16_t y = origin.y, ye = origin.y + height; y < ye; ++y) {
-          for (std::int16_t x = origin.x, xe = origin.x + width; x < xe; ++x, bitmap++) {
-            head_.plot({ x, y }, head_.color_from_head_RGB332(*bitmap));
-          }
-        }
-        break;
-
-      case color::format_RGB555 :
-        for (std::int16_t y = origin.y, ye = origin.y + height; y < ye; ++y) {
-          for (std::int16_t x = origin.x, xe = origin.x + width; x < xe; ++x, bitmap += 2U) {
-            head_.plot({ x, y }, head_.color_from_head_RGB555(*bitmap));
-          }
-        }
-        break;
-
-      case color::format_RGB565 :
-        for (std::int16_t y = origin.y, ye = origin.y + height; y < ye; ++y) {
-          for (std::int16_t x = origin.x, xe = origin.x + width; x < xe; ++x, bitmap += 2U) {
-            head_.plot({ x, y }, head_.color_from_head_RGB565(*bitmap));
-          }
-        }
-        break;
-
-      case color::format_RGB888 :
-        for (std::int16_t y = origin.y, ye = origin.y + height; y < ye; ++y) {
-          for (std::int16_t x = origin.x, xe = origin.x + width; x < xe; ++x, bitmap += 3U) {
-            head_.plot({ x, y }, head_.color_from_head_RGB888(*bitmap));
-          }
-        }
-        break;
-
-      case color::format_ARGB8888 :
-        for (std::int16_t y = origin.y, ye = origin.y + height; y < ye; ++y) {
-          for (std::int16_t x = origin.x, xe = origin.x + width; x < xe; ++x, bitmap += 4U) {
-            head_.plot({ x, y }, head_.color_from_head_RGB555(*bitmap));
-          }
-        }
-        break;
-
-      default :
-        // unsupported format
-        break;
+      }
+    }
+    else {
+      // all other formats are converted span wise by the blitter of the head
+      head_.blitter(origin, { static_cast<std::int16_t>(origin.x + width - 1), static_cast<std::int16_t>(origin.y + height - 1) }, format, bitmap);
     }
     head_.present_lock(false);
   }
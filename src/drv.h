@@ -80,6 +80,24 @@ typedef struct tag_clipping_type
     return !active_ || ((v.x >= v0_.x && v.x <= v1_.x && v.y >= v0_.y && v.y <= v1_.y) ? inside_ : !inside_);
   }
 
+  /**
+   * Test if a rectangle has any pixel which is not clipped
+   * \param v0 Left top corner of the rectangle
+   * \param v1 Bottom right corner of the rectangle
+   * \return True if the rectangle is (partly) visible, false if all of its pixels are clipped
+   */
+  inline bool is_visible(vertex_type v0, vertex_type v1) const {
+    if (!active_) {
+      return true;
+    }
+    if (inside_) {
+      // rectangle must overlap the region
+      return !(v1.x < v0_.x || v0.x > v1_.x || v1.y < v0_.y || v0.y > v1_.y);
+    }
+    // rectangle must not be covered by the region
+    return !(v0.x >= v0_.x && v1.x <= v1_.x && v0.y >= v0_.y && v1.y <= v1_.y);
+  }
+
   /**
    * Enable the clipping function
    * \param enable True to enable
@@ -104,6 +122,13 @@ private:
 } clipping_type;
 
 
+namespace head {
+template<std::uint16_t Screen_Size_X, std::uint16_t Screen_Size_Y, std::size_t HEAD_COUNT> class multihead;
+template<std::uint16_t Screen_Size_X, std::uint16_t Screen_Size_Y, std::size_t HEAD_COUNT> class mirror;
+template<std::uint16_t Screen_Size_X, std::uint16_t Screen_Size_Y> class pipeline;
+} // namespace head
+
+
 class drv : public gpr, public txr
 {
 public:
@@ -300,6 +325,128 @@ public:
   { (void)level; }
 
 
+  ///////////////////////////////////////////////////////////////////////////////
+  // O R I E N T A T I O N
+  //
+
+  /**
+   * Returns true if the orientation swaps the x and y axis (90° and 270° orientations)
+   * \return True if the physical display width is the screen height
+   */
+  inline bool orientation_is_swapped() const
+  { return (static_cast<std::uint8_t>(orientation_) & 0x01U) != 0U; }
+
+
+  /**
+   * Map a logical (screen) vertex to the physical (display) vertex according to the orientation
+   * \param v Vertex in screen coordinates
+   * \return Vertex in physical display coordinates
+   */
+  inline vertex_type orientation_to_physical(vertex_type v) const
+  {
+    const std::int16_t w = static_cast<std::int16_t>(screen_size_x_ - 1U);
+    const std::int16_t h = static_cast<std::int16_t>(screen_size_y_ - 1U);
+    switch (orientation_) {
+      case orientation_90   : return { v.y, static_cast<std::int16_t>(w - v.x) };
+      case orientation_180  : return { static_cast<std::int16_t>(w - v.x), static_cast<std::int16_t>(h - v.y) };
+      case orientation_270  : return { static_cast<std::int16_t>(h - v.y), v.x };
+      case orientation_0m   : return { v.x, static_cast<std::int16_t>(h - v.y) };
+      case orientation_90m  : return { v.y, v.x };
+      case orientation_180m : return { static_cast<std::int16_t>(w - v.x), v.y };
+      case orientation_270m : return { static_cast<std::int16_t>(h - v.y), static_cast<std::int16_t>(w - v.x) };
+      default               : return v;
+    }
+  }
+
+
+  /**
+   * Returns the physical step of a logical step in x direction (x + 1)
+   * \return Physical step, one component is 0, the other one is 1 or -1
+   */
+  inline vertex_type orientation_step_x() const
+  {
+    static const vertex_type step[8] = { { 1, 0 }, { 0, -1 }, { -1, 0 }, { 0, 1 }, { 1, 0 }, { 0, 1 }, { -1, 0 }, { 0, -1 } };
+    return step[orientation_ & 0x07U];
+  }
+
+
+  /**
+   * Returns the physical step of a logical step in y direction (y + 1)
+   * \return Physical step, one component is 0, the other one is 1 or -1
+   */
+  inline vertex_type orientation_step_y() const
+  {
+    static const vertex_type step[8] = { { 0, 1 }, { 1, 0 }, { 0, -1 }, { -1, 0 }, { 0, -1 }, { 1, 0 }, { 0, 1 }, { -1, 0 } };
+    return step[orientation_ & 0x07U];
+  }
+
+
+  /**
+   * Map a logical 8x8 monochrome block to the physical block according to the orientation
+   * This is the rotation kernel of monochrome heads and packed 1 bpp buffers, see util::bit_transpose_8x8()
+   * \param block Logical block, row y in byte y, pixel x in bit x
+   * \return Physical block
+   */
+  inline std::uint64_t orientation_to_physical_8x8(std::uint64_t block) const
+  {
+    switch (orientation_) {
+      case orientation_90   : return util::bit_flip_8x8(util::bit_transpose_8x8(block));
+      case orientation_180  : return util::bit_flip_8x8(util::bit_mirror_8x8(block));
+      case orientation_270  : return util::bit_mirror_8x8(util::bit_transpose_8x8(block));
+      case orientation_0m   : return util::bit_flip_8x8(block);
+      case orientation_90m  : return util::bit_transpose_8x8(block);
+      case orientation_180m : return util::bit_mirror_8x8(block);
+      case orientation_270m : return util::bit_mirror_8x8(util::bit_flip_8x8(util::bit_transpose_8x8(block)));
+      default               : return block;
+    }
+  }
+
+
+  ///////////////////////////////////////////////////////////////////////////////
+  // T E X T   O U T P U T
+  //
+
+  /**
+   * Glyph runs of the text renderer are passed as spans to the head
+   */
+  virtual void text_span(vertex_type start, std::uint16_t length, color::value_type color)
+  {
+    span_horz(start, length, color);
+  }
+
+
+  virtual void text_span(vertex_type start, std::uint16_t length, const color::value_type* colors)
+  {
+    span_horz(start, length, colors);
+  }
+
+
+  /**
+   * Glyphs which are completely outside the screen or the clipping region are culled
+   */
+  virtual bool text_is_visible(vertex_type top_left, vertex_type bottom_right) const
+  {
+    return (bottom_right.x >= 0) && (bottom_right.y >= 0) &&
+           (top_left.x < static_cast<std::int16_t>(screen_size_x_)) && (top_left.y < static_cast<std::int16_t>(screen_size_y_)) &&
+           clipping_.is_visible(top_left, bottom_right);
+  }
+
+
+  /**
+   * The stripe order of the panel is mapped by the orientation: mirrored x directions swap the order,
+   * rotated screens have the stripes in y direction, so their text isn't subpixel rendered
+   */
+  virtual text_subpixel_type text_subpixel_order() const
+  {
+    const text_subpixel_type order = drv_subpixel_order();
+    const vertex_type        step  = orientation_step_x();
+    if ((order == text_subpixel_none) || step.y) {
+      return text_subpixel_none;
+    }
+    return (step.x > 0) ? order : ((order == text_subpixel_rgb) ? text_subpixel_bgr : text_subpixel_rgb);
+  }
+
+
   ///////////////////////////////////////////////////////////////////////////////
   // C L I P P I N G   F U N C T I O N S 
   //
@@ -331,71 +478,88 @@ public:
 
   /**
    * Convert internal 32 bpp ARGB color to native head color format
+   * Wrappers of the color::pixel_format<> traits, see format.h
    * \param color Internal 32 bpp ARGB color value
    * \return Native head color value
    */
   inline std::uint8_t color_to_head_L1(color::value_type color) const
-  { return static_cast<std::uint8_t>((color & 0x00FFFFFFUL) != (std::uint32_t)0U ? 1U : 0U); }
+  { return color::pixel_format<color::format_L1>::pack(color); }
 
   inline std::uint8_t color_to_head_L2(color::value_type color) const
-  { return static_cast<std::uint8_t>(((std::uint16_t)((std::uint16_t)color::get_red(color) + (std::uint16_t)color::get_green(color) + (std::uint16_t)color::get_blue(color)) / 3U) >> 6U); }
+  { return color::pixel_format<color::format_L2>::pack(color); }
 
   inline std::uint8_t color_to_head_L4(color::value_type color) const
-  { return static_cast<std::uint8_t>(((std::uint16_t)((std::uint16_t)color::get_red(color) + (std::uint16_t)color::get_green(color) + (std::uint16_t)color::get_blue(color)) / 3U) >> 4U); }
+  { return color::pixel_format<color::format_L4>::pack(color); }
 
   inline std::uint8_t color_to_head_L8(color::value_type color) const
-  { return static_cast<std::uint8_t>((std::uint16_t)((std::uint16_t)color::get_red(color) + (std::uint16_t)color::get_green(color) + (std::uint16_t)color::get_blue(color)) / 3U); }
+  { return color::pixel_format<color::format_L8>::pack(color); }
 
   inline std::uint8_t color_to_head_RGB332(color::value_type color) const
-  { return static_cast<std::uint8_t>((std::uint8_t)(color::get_red(color) & 0xE0U) | (std::uint8_t)((color::get_green(color) & 0xE0U) >> 3U) | (std::uint8_t)((color::get_blue(color)) >> 6U)); }
+  { return color::pixel_format<color::format_RGB332>::pack(color); }
 
   inline std::uint16_t color_to_head_RGB444(color::value_type color) const
-  { return static_cast<std::uint16_t>(((std::uint16_t)(color::get_red(color) & 0xF0U) <<  8U) | ((std::uint16_t)(color::get_green(color) & 0xF0U) << 4U) | (std::uint16_t)(color::get_blue(color) >> 4U)); }
+  { return color::pixel_format<color::format_RGB444>::pack(color); }
 
   inline std::uint16_t color_to_head_RGB555(color::value_type color) const
-  { return static_cast<std::uint16_t>(((std::uint16_t)(color::get_red(color) & 0xF8U) << 10U) | ((std::uint16_t)(color::get_green(color) & 0xF8U) << 5U) | (std::uint16_t)(color::get_blue(color) >> 3U)); }
+  { return color::pixel_format<color::format_RGB555>::pack(color); }
 
   inline std::uint16_t color_to_head_RGB565(color::value_type color) const
-  { return static_cast<std::uint16_t>(((std::uint16_t)(color::get_red(color) & 0xF8U) << 11U) | ((std::uint16_t)(color::get_green(color) & 0xFCU) << 5U) | (std::uint16_t)(color::get_blue(color) >> 3U)); }
+  { return color::pixel_format<color::format_RGB565>::pack(color); }
 
   inline std::uint32_t color_to_head_RGB666(color::value_type color) const
-  { return static_cast<std::uint32_t>(((std::uint32_t)(color::get_red(color) & 0xFCU) << 12U) | ((std::uint32_t)(color::get_green(color) & 0xFCU) << 6U) | (std::uint32_t)(color::get_blue(color) >> 2U)); }
+  { return color::pixel_format<color::format_RGB666>::pack(color); }
 
   inline std::uint32_t color_to_head_RGB888(color::value_type color) const
-  { return static_cast<std::uint32_t>(color & 0x00FFFFFFUL); }
+  { return color::pixel_format<color::format_RGB888>::pack(color); }
 
   inline color::value_type color_from_head_L1(std::uint8_t head_color) const
-  { return head_color ? color::white : color::black; }
+  { return color::pixel_format<color::format_L1>::unpack(head_color); }
 
   inline color::value_type color_from_head_L2(std::uint8_t head_color) const
-  { return color::dim(color::white, (255U / 3U * (head_color & 0x03U))); }
+  { return color::pixel_format<color::format_L2>::unpack(head_color); }
 
   inline color::value_type color_from_head_L4(std::uint8_t head_color) const
-  { return color::dim(color::white, (255U / 15U * (head_color & 0x0FU))); }
+  { return color::pixel_format<color::format_L4>::unpack(head_color); }
 
   inline color::value_type color_from_head_L8(std::uint8_t head_color) const
-  { return color::dim(color::white, head_color); }
+  { return color::pixel_format<color::format_L8>::unpack(head_color); }
 
   inline color::value_type color_from_head_RGB332(std::uint8_t head_color) const
-  { return color::argb(static_cast<std::uint8_t>(head_color & 0xE0U), static_cast<std::uint8_t>((head_color & 0x1CU) << 3U), static_cast<std::uint8_t>((head_color & 0x03U) << 6U)); }
+  { return color::pixel_format<color::format_RGB332>::unpack(head_color); }
 
   inline color::value_type color_from_head_RGB444(std::uint16_t head_color) const
-  { return color::argb(static_cast<std::uint8_t>((head_color & 0x0F00U) >> 4U), static_cast<std::uint8_t>((head_color & 0x00F0U)      ), static_cast<std::uint8_t>((head_color & 0x000FU) << 4U)); }
+  { return color::pixel_format<color::format_RGB444>::unpack(head_color); }
 
   inline color::value_type color_from_head_RGB555(std::uint16_t head_color) const
-  { return color::argb(static_cast<std::uint8_t>((head_color & 0x7C00U) >> 7U), static_cast<std::uint8_t>((head_color & 0x03E0U) >> 2U), static_cast<std::uint8_t>((head_color & 0x001FU) << 3U)); }
+  { return color::pixel_format<color::format_RGB555>::unpack(head_color); }
 
   inline color::value_type color_from_head_RGB565(std::uint16_t head_color) const
-  { return color::argb(static_cast<std::uint8_t>((head_color & 0xF800U) >> 8U), static_cast<std::uint8_t>((head_color & 0x07E0U) >> 3U), static_cast<std::uint8_t>((head_color & 0x001FU) << 3U)); }
+  { return color::pixel_format<color::format_RGB565>::unpack(head_color); }
 
   inline color::value_type color_from_head_RGB666(std::uint32_t head_color) const
-  { return color::argb(static_cast<std::uint8_t>((head_color & 0x0003F000UL) >> 10U), static_cast<std::uint8_t>((head_color & 0x00000FC0UL) >> 4U), static_cast<std::uint8_t>((head_color & 0x0000003FUL) << 2U)); }
+  { return color::pixel_format<color::format_RGB666>::unpack(head_color); }
 
   inline color::value_type color_from_head_RGB888(std::uint32_t head_color) const
-  { return static_cast<color::value_type>(head_color & 0x00FFFFFFUL); }
+  { return color::pixel_format<color::format_RGB888>::unpack(head_color); }
 
 
 protected:
+
+  /**
+   * Returns the physical stripe order of the panel, heads with an LCD stripe panel override it
+   * Subpixel rendered glyphs are blended over the read back screen pixels, so the head must support drv_pixel_get()
+   * \return Stripe order in physical x direction, text_subpixel_none if the panel has no (known) stripes
+   */
+  virtual text_subpixel_type drv_subpixel_order() const
+  { return text_subpixel_none; }
+
+
+  // the multihead, mirror and pipeline drivers call the drv functions of their heads
+  template<std::uint16_t Screen_Size_X, std::uint16_t Screen_Size_Y, std::size_t HEAD_COUNT> friend class head::multihead;
+  template<std::uint16_t Screen_Size_X, std::uint16_t Screen_Size_Y, std::size_t HEAD_COUNT> friend class head::mirror;
+  template<std::uint16_t Screen_Size_X, std::uint16_t Screen_Size_Y> friend class head::pipeline;
+
+
   const std::uint16_t     screen_size_x_;     // screen (buffer) width  in pixel (graphic) or chars (alpha)
   const std::uint16_t     screen_size_y_;     // screen (buffer) height in pixel (graphic) or chars (alpha)
   const std::uint16_t     viewport_size_x_;   // viewport (display) width in pixel (graphic) or chars (alpha)
@@ -69,6 +69,8 @@ class BA6x : public drv
   static const std::uint8_t ESC                 = 0x1BU;    // escape char
 
   const io::dev::handle_type device_handle_;                // logical device handle (uart or usb)
+  std::uint8_t  payload_[BA6X_MAX_CMD_LENGTH - 3U];         // coalesced command data, sent as one message
+  std::uint8_t  payload_count_;                             // count of coalesced bytes
 
 
 /////////////////////////////////////////////////////////////////////////////
@@ -85,6 +87,7 @@ public:
           Model == BA60 ? 16U : 20U, Model == BA60 ? 1U : Model == BA63 ? 2U : 4U,    // viewport size (same as screen)
           0, 0, orientation_0)
     , device_handle_(device_handle)
+    , payload_count_(0U)
   { }
 
 
@@ -113,6 +116,7 @@ protected:
 
     // explicit cursor home
     text_pos({ 0, 0 });
+    write_flush();
   }
 
 
@@ -120,6 +124,7 @@ protected:
   {
     // clear buffer
     drv_cls();
+    write_flush();
   }
 
 
@@ -156,8 +161,11 @@ protected:
   }
 
 
+  // send the coalesced command data
   inline virtual void drv_present() final
-  { }
+  {
+    write_flush();
+  }
 
 
   /**
@@ -215,7 +223,7 @@ protected:
    * Output one character at the actual position
    * \param ch Output character in ASCII/UNICODE (NOT UTF-8) format
    */
-  inline virtual void text_char(std::uint16_t ch) final
+  inline virtual void text_char(std::uint32_t ch) final
   {
     if (ch < 0x20U) {
       // ignore non characters
@@ -225,7 +233,8 @@ protected:
     // check limits
     if (screen_is_inside({ text_x_act_, text_y_act_ })) {
       // send command
-      write_command(reinterpret_cast<std::uint8_t*>(&ch), 1U);
+      const std::uint8_t data = static_cast<std::uint8_t>(ch);
+      write_command(&data, 1U);
     }
 
     // inc x and reposition cursor if at end of line and implicit CR occured
@@ -268,6 +277,7 @@ protected:
 
       // send command
       write_command(string + off, len);
+      present();
       return len;
     }
     return 0U;
@@ -340,8 +350,10 @@ public:
    * Perform a display self test
    * \return true if successful
    */
-  void self_test() const
+  void self_test()
   {
+    write_flush();
+
     // wait that display is ready for command
     for (std::uint8_t n = 0U; !device_ready() && (n < 10U); ++n);
 
@@ -357,8 +369,10 @@ public:
    * Check if display is ready
    * \return true if display is ready
    */
-  bool device_ready() const
+  bool device_ready()
   {
+    write_flush();
+
     // status request command: 00H, 20H, 00H, 00H
     const std::uint8_t cmd[4] = { 0x00U, 0x20U, 0x00U, 0x00U };
 
@@ -381,7 +395,43 @@ public:
 
 private:
 
-  void write_command(const std::uint8_t* data, std::uint16_t data_count) const
+  /**
+   * Append command data, the data of consecutive commands is sent in one message,
+   * if the message is full, on present or before a status request
+   * \param data Command data
+   * \param data_count Count of bytes
+   */
+  void write_command(const std::uint8_t* data, std::uint16_t data_count)
+  {
+    if (!VIC_IO_TRANSACTION_BUFFER_SIZE) {
+      // coalescing disabled
+      write_message(data, data_count);
+      return;
+    }
+    while (data_count) {
+      const std::uint16_t blk_size = data_count > sizeof(payload_) - payload_count_ ? static_cast<std::uint16_t>(sizeof(payload_) - payload_count_) : data_count;
+      memcpy(&payload_[payload_count_], data, blk_size);
+      payload_count_ = static_cast<std::uint8_t>(payload_count_ + blk_size);
+      data       += blk_size;
+      data_count -= blk_size;
+      if (payload_count_ == sizeof(payload_)) {
+        write_flush();
+      }
+    }
+  }
+
+
+  // send the coalesced command data
+  void write_flush()
+  {
+    if (payload_count_) {
+      write_message(payload_, payload_count_);
+      payload_count_ = 0U;
+    }
+  }
+
+
+  void write_message(const std::uint8_t* data, std::uint16_t data_count) const
   {
     // write data command is 02H, 00H, Data Count, Data Bytes
     // maximum length of one message the display can handle is BA6X_MAX_CMD_LENGTH
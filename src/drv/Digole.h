@@ -31,6 +31,7 @@
 #define _VIC_DRV_DIGOLE_H_
 
 #include "../drv.h"
+#include "../io_transaction.h"
 
 
 // defines the driver name and version
@@ -65,18 +66,17 @@ public:
 
   /**
    * ctor
-   * \param orientation Screen orientation
+   * \param orientation Screen orientation, set as display rotation (0° to 270°)
+   * \param device_handle Logical device handle of the SPI device, I²C address or UART port
    * \param iface Interface type, SPI, I²C or UART are valid
-   * \param iface_id Interface id: SPI: device id, I²C: address, UART: port_id
    * \param uart_baudrate Baudrate of the UART interface, unused for SPI or I²C mode
    */
-  digole(orientation_type orientation, device_handle_type device_handle,
+  digole(orientation_type orientation, io::dev::handle_type device_handle,
          interface_type iface, std::uint32_t uart_baudrate = 9600U)
     : drv(Screen_Size_X,   Screen_Size_Y,
           Viewport_Size_X, Viewport_Size_Y,
-          0U, 0U)
-    , orientation_(orientation)
-    , device_handle_(device_handle)
+          0, 0, orientation)
+    , io_(device_handle)
     , interface_(iface)
     , uart_baudrate_(uart_baudrate)
   { }
@@ -96,19 +96,8 @@ protected:
 
   virtual void drv_init() final
   {
-    if (interface_ == i2c) {
-      // set I²C address
-      std::uint8_t i2c_adr = static_cast<std::uint8_t>(interface_port_);
-      interface_port_ = 0x27;   // use default I²C address ($27) for init
-      cmd_[0] = 'S';
-      cmd_[1] = 'I';
-      cmd_[2] = '2';
-      cmd_[3] = 'C';
-      cmd_[4] = 'A';
-      cmd_[5] =  i2c_adr;
-      write(cmd_, 6U);
-      interface_port_ = i2c_adr;  // use new address now
-    }
+    // the I²C address is part of the device handle, a display with another than the default
+    // address ($27) must be set up with the 'SI2CA' command before
 
     // set orientation
     cmd_[0] = 'S';
@@ -142,17 +131,18 @@ protected:
       }
       write(cmd_, len);
     }
+    io_.flush();
   }
 
 
-  void drv_shutdown()
+  virtual void drv_shutdown() final
   {
     drv_cls();
     brightness_set(0U);     // display off
   }
 
 
-  inline const char* drv_version() const final
+  inline virtual const char* drv_version() const final
   {
     return (const char*)VIC_DRV_DIGOLE_VERSION;
   }
@@ -205,9 +195,9 @@ protected:
     cmd_[10] = 'E';
     cmd_[11] = 'S';
     cmd_[12] = 'C';
-    cmd_[13] = color::get_red(color_);
-    cmd_[14] = color::get_green(color_);
-    cmd_[15] = color::get_blue(color_);
+    cmd_[13] = color::get_red(pen_get_color());
+    cmd_[14] = color::get_green(pen_get_color());
+    cmd_[15] = color::get_blue(pen_get_color());
     write(cmd_, 16U);
   }
 
@@ -217,13 +207,26 @@ protected:
    * To get the pixel color, a buffer would be necessary to store a display content copy locally, about 60k for 160x128 RGB
    * Therefore this function is not implemented, anti aliasing, sprites and fill function don't work.
    */
-  inline color::value_type drv_pixel_get(vertex_type) final
+  inline virtual color::value_type drv_pixel_get(vertex_type) final
+  {
+    return bg_get_color();
+  }
+
+
+  // pass the coalesced commands to the display
+  virtual void drv_present() final
   {
-    return color_bg_get();
+    io_.flush();
   }
 
 
-  inline void pixel_set(vertex_type point) final
+public:
+
+  ///////////////////////////////////////////////////////////////////////////////
+  // overwritten gpr functions, rendered by the display firmware
+  //
+
+  inline virtual void pixel_set(vertex_type point) final
   {
     // check limits and clipping
     if (!screen_is_inside(point) || (!clipping_.is_inside(point))) {
@@ -231,9 +234,9 @@ protected:
       return;
     }
 
-    if (color_pen_function_) {
-      // color pen function is set, so use the base class to render the pixel
-      base::pixel_set(point);
+    if (pen_color_is_function()) {
+      // color pen function is set, so use the gpr to render the pixel
+      gpr::pixel_set(point);
       return;
     }
 
@@ -246,7 +249,7 @@ protected:
   }
 
 
-  void brightness_set(std::uint8_t level)
+  virtual void brightness_set(std::uint8_t level) final
   {
     cmd_[0] = 'B';
     cmd_[1] = 'L';
@@ -256,12 +259,15 @@ protected:
     cmd_[5] = 'O';
     cmd_[6] = level == 0U ? 0U : 1U;
     write(cmd_, 7U);
+    io_.flush();
   }
 
 
-  virtual void color_pen_set(color::value_type color) final
+  using drv::pen_set_color;
+
+  virtual void pen_set_color(color::value_type color) final
   {
-    base::color_pen_set(color);
+    drv::pen_set_color(color);
 
     cmd_[0] = 'E';
     cmd_[1] = 'S';
@@ -274,9 +280,9 @@ protected:
 
   virtual void line_horz(vertex_type v0, vertex_type v1) final
   {
-    // check clipping
-    if (clipping_.is_enabled()) {
-      // Digole displays doesn't support clipping, use the gpr instead
+    // check clipping and pen function
+    if (clipping_.is_enabled() || pen_color_is_function()) {
+      // Digole displays doesn't support clipping and color functions, use the gpr instead
       gpr::line_horz(v0, v1);
       return;
     }
@@ -289,15 +295,16 @@ protected:
     cmd_[4] = static_cast<std::uint8_t>(v1.x);
     cmd_[5] = static_cast<std::uint8_t>(v1.y);
     write(cmd_, 6U);
+    present();
   }
 
 
   virtual void line_vert(vertex_type v0, vertex_type v1) final
   {
-    // check clipping
-    if (clipping_.is_enabled()) {
-      // Digole displays doesn't support clipping, use the gpr instead
-      gpr::drv_line_vert(v0, v1);
+    // check clipping and pen function
+    if (clipping_.is_enabled() || pen_color_is_function()) {
+      // Digole displays doesn't support clipping and color functions, use the gpr instead
+      gpr::line_vert(v0, v1);
       return;
     }
 
@@ -309,21 +316,21 @@ protected:
     cmd_[4] = static_cast<std::uint8_t>(v1.x);
     cmd_[5] = static_cast<std::uint8_t>(v1.y);
     write(cmd_, 6U);
+    present();
   }
 
 
-  void box(vertex_type v0, vertex_type v1)
+  virtual void box(vertex_type v0, vertex_type v1) final
   {
-    // check clipping
-    if (clipping_.is_enabled()) {
-      // Digole displays doesn't support clipping, use the gpr instead
-      gpr::drv_box(v0, v1);
+    // check clipping and pen function
+    if (clipping_.is_enabled() || pen_color_is_function()) {
+      // Digole displays doesn't support clipping and color functions, use the gpr instead
+      gpr::box(v0, v1);
       return;
     }
 
-    std::int16_t tmp;
-    if (x0 > x1) { tmp = x0; x0 = x1; x1 = tmp; }
-    if (y0 > y1) { tmp = y0; y0 = y1; y1 = tmp; }
+    // make sure v0 is top/left
+    vertex_top_left(v0, v1);
 
     cmd_[0] = 'F';
     cmd_[1] = 'R';
@@ -332,6 +339,7 @@ protected:
     cmd_[4] = static_cast<std::uint8_t>(v1.x);
     cmd_[5] = static_cast<std::uint8_t>(v1.y);
     write(cmd_, 6U);
+    present();
   }
 
 
@@ -375,12 +383,12 @@ protected:
 #endif
 
 
-  void move(vertex_type source, vertex_type destination, std::uint16_t width, std::uint16_t height)
+  virtual void move(vertex_type source, vertex_type destination, std::uint16_t width, std::uint16_t height) final
   {
     // check clipping
     if (clipping_.is_enabled()) {
       // Digole displays doesn't support clipping, use the gpr instead
-      gpr::drv_move(source, destination, width, height);
+      gpr::move(source, destination, width, height);
       return;
     }
 
@@ -393,17 +401,19 @@ protected:
     cmd_[6] = static_cast<std::uint8_t>(destination.x);
     cmd_[7] = static_cast<std::uint8_t>(destination.y);
     (void)write(cmd_, 8U);
+    present();
   }
 
 
 private:
 
+  // commands are coalesced in the transaction buffer and passed on present
   inline void write(const std::uint8_t* buffer, std::uint16_t length)
   {
-    io::dev::write(device_handle_, 0U, buffer, length, nullptr, 0U);
+    io_.write(0U, buffer, length);
   }
 
-  device_handle_type  device_handle_;   // device handle
+  io::transaction<>   io_;              // device writes
   interface_type      interface_;       // interface type
   std::uint32_t       uart_baudrate_;   // baudrate for UART interface mode
   std::uint8_t        cmd_[16U];        // command buffer
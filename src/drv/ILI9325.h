@@ -31,6 +31,7 @@
 #define _VIC_DRV_ILI9325_H_
 
 #include "../drv.h"
+#include "../io_transaction.h"
 
 
 // defines the driver name and version
@@ -109,11 +110,17 @@ private:
   static const std::uint8_t REG_OTP_VCM_STATUS         = 0xA2U;
   static const std::uint8_t REG_OTP_PRG_ID_KEY         = 0xA5U;
 
-  const io::dev::handle_type  device_handle_;
+  io::transaction<interface_mode == 0U ? VIC_IO_TRANSACTION_BUFFER_SIZE : 0U> io_;   // device writes, GRAM data is passed in bursts
   void*                       mem_reg_addr_;
   void*                       mem_data_addr_;
   const bool                  spi_id_bit_;           // level of IM0/ID hardware pin
-  vertex_type                 gram_pos_; 
+  vertex_type                 gram_pos_;             // physical GRAM address of the next pixel
+  vertex_type                 gram_step_;            // physical GRAM address increment, set by the entry mode
+  std::uint16_t               entry_mode_;           // actual entry mode register value
+
+  // native head color format, depending on the color mode
+  typedef color::pixel_format<color_256k ? color::format_RGB666 : color::format_RGB565> format;
+  static const std::size_t    pixel_bytes = color_256k ? 3U : 2U;   // bytes per pixel transfer
 
 public:
 
@@ -133,11 +140,13 @@ public:
           Screen_Size_X, Screen_Size_Y,         // no viewport support (screen = viewport)
           0, 0,                                 // no viewport support
           orientation)
-    , device_handle_(device_handle)
+    , io_(device_handle)
     , mem_reg_addr_(mem_reg_addr)
     , mem_data_addr_(mem_data_addr)
     , spi_id_bit_(spi_id_bit)
     , gram_pos_({ 0x7FFF, 0x7FFF })
+    , gram_step_({ 1, 0 })
+    , entry_mode_(0x0030U)
   { }
 
 
@@ -164,16 +173,18 @@ protected:
     const bool DFM = (interface_mode == 16U) && (color_256k); // set if 16 bit and 256k colors
     const bool BGR = RGB_to_BGR;
 
-    io::delay(200);    // wait 200 ms for display power stabalization
+    io_.delay(200);    // wait 200 ms for display power stabalization
 
     // power supply initial setting sequence
     write_reg(REG_OSC_CTRL,             0x0001);  // start osc
     write_reg(REG_DRV_OUTPUT_CTRL,      0x0100);  // set SS
     write_reg(REG_DRV_WAVE_CTRL,        0x0700);  // set B/C and EOR
-    write_reg(REG_ENTRY_MODE,           (TRI ? 0x8000U : 0x0000U) |  // TRI = 0/1
-                                        (DFM ? 0x4000U : 0x0000U) |  // DFM = 0/1
-                                        (BGR ? 0x1000U : 0x0000U) |  // BGR = 0/1
-                                        0x0030);                     // BGR = 0
+    entry_mode_ = static_cast<std::uint16_t>((TRI ? 0x8000U : 0x0000U) |  // TRI = 0/1
+                                             (DFM ? 0x4000U : 0x0000U) |  // DFM = 0/1
+                                             (BGR ? 0x1000U : 0x0000U) |  // BGR = 0/1
+                                             0x0030U);                    // ID = 11 (x and y increment), AM = 0 (horizontal)
+    gram_step_  = { 1, 0 };
+    write_reg(REG_ENTRY_MODE,           entry_mode_);
     write_reg(REG_RESIZE_CTRL,          0x0000);  // disable resize
     write_reg(REG_DISP_CTRL1,           0x0000);  // DTE = 0, GON = 0, D[1:0] = 00
     write_reg(REG_DISP_CTRL2,           0x0202);  // front porch = 2 lines, back porch 2 lines
@@ -187,7 +198,7 @@ protected:
     write_reg(REG_POW_CTRL3,            0x0000);  // VRH = 0, PON = 0
     write_reg(REG_POW_CTRL4,            0x0000);  // VDV = 0
     write_reg(REG_POW_CTRL7,            0x0000);  // VCM = 0
-    io::delay(50);    // wait for 50 ms
+    io_.delay(50);    // wait for 50 ms
 
     // power supply operation sequence
     write_reg(REG_POW_CTRL1,            0x0490);  // SAP = 0, BT (step-up factor) = 4, APE = 1, driver amplifiers = 1.00
@@ -195,18 +206,18 @@ protected:
     write_reg(REG_POW_CTRL3,            0x001F);  // VRH = F (Vci * 1.95), PON = 1, use external reference voltage
     write_reg(REG_POW_CTRL4,            0x1500);  // set VCOM amplitude = VREG1OUT x 1.04
     write_reg(REG_POW_CTRL7,            0x0027);  // set VCOMH = VREG1OUT x 0.880
-    io::delay(80);    // wait for 80 ms
+    io_.delay(80);    // wait for 80 ms
 
     // display ON sequence
     write_reg(REG_POW_CTRL1,            0x1490);  // SAP = 1, BT (step-up factor) = 4, APE = 1, driver amplifiers = 1.00
     write_reg(REG_DISP_CTRL1,           0x0001);  // DTE = 0, GON = 0, D[1:0] = 01
-    io::delay(20);    // wait for 20 ms
+    io_.delay(20);    // wait for 20 ms
     write_reg(REG_DISP_CTRL1,           0x0021);  // DTE = 0, GON = 1, D[1:0] = 01
-    io::delay(20);    // wait for 20 ms
+    io_.delay(20);    // wait for 20 ms
     write_reg(REG_DISP_CTRL1,           0x0023);  // DTE = 0, GON = 1, D[1:0] = 11
-    io::delay(20);    // wait for 20 ms
+    io_.delay(20);    // wait for 20 ms
     write_reg(REG_DISP_CTRL1,           0x0133);  // DTE = 1, GON = 1, D[1:0] = 11, BASEE = 1
-    io::delay(20);    // wait for 20 ms
+    io_.delay(20);    // wait for 20 ms
 
     // init misc registers
     write_reg(REG_FRM_RATE_COLOR_CTRL,  0x000C);  // set frame rate to 80 Hz
@@ -252,6 +263,7 @@ protected:
 
     // clear buffer
     drv_cls();
+    io_.flush();
   }
 
 
@@ -268,26 +280,26 @@ protected:
   }
 
 
+  inline virtual text_subpixel_type drv_subpixel_order() const final
+  {
+    // the BGR bit swaps the R and B components to the source lines, so the stripes appear swapped
+    return RGB_to_BGR ? text_subpixel_bgr : text_subpixel_rgb;
+  }
+
+
   virtual void drv_cls() final
   { 
-    for (std::int_fast16_t y = 0; y < Screen_Size_Y; ++y) {
-      // set y GRAM position
-      write_reg(REG_GRAM_HOR_ADDR, static_cast<std::uint16_t>(0));
-      write_reg(REG_GRAM_VER_ADDR, static_cast<std::uint16_t>(y));
-      write_idx(REG_GRAM_DATA);
-
-      // set pixel to black
-      for (std::int_fast16_t x = 0; x < Screen_Size_X; ++x) {
-        if (!color_256k) {
-          // 64k color mode
-          write_data(0U, 2U);
-        }
-        else {
-          // 256k color mode
-          write_data(0U, 3U);
-        }
-      }
+    // set GRAM position to 0,0 in horizontal increment mode
+    gram_direction_set({ 1, 0 });
+    write_reg(REG_GRAM_HOR_ADDR, static_cast<std::uint16_t>(0));
+    write_reg(REG_GRAM_VER_ADDR, static_cast<std::uint16_t>(0));
+    write_idx(REG_GRAM_DATA);
+
+    // set all pixels to black, the GRAM address wraps within the window
+    for (std::uint_fast32_t n = 0U; n < static_cast<std::uint_fast32_t>(Screen_Size_X) * Screen_Size_Y; ++n) {
+      write_data(0U, pixel_bytes);
     }
+    gram_pos_ = { 0x7FFF, 0x7FFF };
   }
 
 
@@ -300,22 +312,10 @@ protected:
     }
 
     // set GRAM position
-    if (gram_pos_ != point) {
-      write_reg(REG_GRAM_HOR_ADDR, static_cast<std::uint16_t>(point.x));
-      write_reg(REG_GRAM_VER_ADDR, static_cast<std::uint16_t>(point.y));
-    }
-    gram_pos_ = { ++point.x, point.y };
+    gram_pos_set(orientation_to_physical(point));
 
-    if (!color_256k) {
-      // 64k color mode
-      write_idx(REG_GRAM_DATA);
-      write_data(color_to_head_RGB565(color), 2U);
-    }
-    else {
-      // 256k color mode
-      write_idx(REG_GRAM_DATA);
-      write_data(color_to_head_RGB666(color), 3U);
-    }
+    write_idx(REG_GRAM_DATA);
+    write_data(format::pack(color), pixel_bytes);
   }
 
 
@@ -328,37 +328,100 @@ protected:
     }
 
     // set GRAM position
-    if (gram_pos_ != point) {
-      write_reg(REG_GRAM_HOR_ADDR, static_cast<std::uint16_t>(point.x));
-      write_reg(REG_GRAM_VER_ADDR, static_cast<std::uint16_t>(point.y));
-    }
-    gram_pos_ = { ++point.x, point.y };
+    gram_pos_set(orientation_to_physical(point));
 
-    if (!color_256k) {
-      std::uint8_t data[2];
-      //read_data(data, 2U);
-      return color_from_head_RGB565(static_cast<std::uint16_t>(data[0] << 8U) |
-                                    static_cast<std::uint16_t>(data[1]));
-    }
-    else {
-      std::uint8_t data[3];
-      //read_data();
-      return color_from_head_RGB666(static_cast<std::uint32_t>(data[0] << 16U) |
-                                    static_cast<std::uint32_t>(data[1] <<  8U) |
-                                    static_cast<std::uint32_t>(data[2]));
-    }
+    write_idx(REG_GRAM_DATA);
+    const std::uint32_t data = read_gram();
+    gram_pos_ = { 0x7FFF, 0x7FFF };   // the dummy read advances the GRAM address too, set it again on the next write
+    return format::unpack(static_cast<typename format::head_type>(data));
   }
 
 
-  // unused - data is written directly to the dislay
+  // pass the buffered writes to the display, memory interfaces write directly
   virtual void drv_present() final
-  { }
+  {
+    io_.flush();
+  }
+
 
+public:
 
   ///////////////////////////////////////////////////////////////////////////////
   // overwritten gpr functions for faster rendering
   //
  
+  /**
+   * Set a horizontal span of pixels in the given color
+   * The GRAM address is set once, the pixels are streamed by the address auto increment
+   * \param start Left vertex of the span
+   * \param length Span length in pixel
+   * \param color Color of the span
+   */
+  virtual void span_horz(vertex_type start, std::uint16_t length, color::value_type color) final
+  {
+    if (clipping_.is_enabled()) {
+      // use the pixel wise fallback in case of active clipping
+      gpr::span_horz(start, length, color);
+      return;
+    }
+    span_fill(start, length, false, color);
+  }
+
+
+  /**
+   * Set a horizontal span of pixels out of a color array
+   * The GRAM address is set once, the pixels are streamed by the address auto increment
+   * \param start Left vertex of the span
+   * \param length Span length in pixel
+   * \param colors Array of 'length' colors in ARGB format
+   */
+  virtual void span_horz(vertex_type start, std::uint16_t length, const color::value_type* colors) final
+  {
+    if (clipping_.is_enabled()) {
+      // use the pixel wise fallback in case of active clipping
+      gpr::span_horz(start, length, colors);
+      return;
+    }
+    span_copy(start, length, false, colors);
+  }
+
+
+  /**
+   * Set a vertical span of pixels in the given color
+   * The GRAM address is set once, the pixels are streamed by the address auto increment
+   * \param start Top vertex of the span
+   * \param length Span length in pixel
+   * \param color Color of the span
+   */
+  virtual void span_vert(vertex_type start, std::uint16_t length, color::value_type color) final
+  {
+    if (clipping_.is_enabled()) {
+      // use the pixel wise fallback in case of active clipping
+      gpr::span_vert(start, length, color);
+      return;
+    }
+    span_fill(start, length, true, color);
+  }
+
+
+  /**
+   * Set a vertical span of pixels out of a color array
+   * The GRAM address is set once, the pixels are streamed by the address auto increment
+   * \param start Top vertex of the span
+   * \param length Span length in pixel
+   * \param colors Array of 'length' colors in ARGB format
+   */
+  virtual void span_vert(vertex_type start, std::uint16_t length, const color::value_type* colors) final
+  {
+    if (clipping_.is_enabled()) {
+      // use the pixel wise fallback in case of active clipping
+      gpr::span_vert(start, length, colors);
+      return;
+    }
+    span_copy(start, length, true, colors);
+  }
+
+
   /**
    * Draw a horizontal line, width is one pixel, no pen support
    * \param v0 Start vertex, included in line
@@ -367,42 +430,38 @@ protected:
    */
   virtual void line_horz(vertex_type v0, vertex_type v1) final
   {
-    // set y GRAM position
-    write_reg(REG_GRAM_HOR_ADDR, static_cast<std::uint16_t>(0));
-    write_reg(REG_GRAM_VER_ADDR, static_cast<std::uint16_t>(v0.y));
-    write_idx(REG_GRAM_DATA);
-
     // swap x
     vertex_min_x(v0, v1);
 
-    if (!color_256k) {
-      // 64k color mode
-      if (pen_color_is_function()) {
-        for (; v0.x <= v1.x; ++v0.x) {
-          write_data(color_to_head_RGB565(pen_get_color(v0)), 2U);
-        }
-      }
-      else {
-        const std::uint16_t color = color_to_head_RGB565(pen_get_color());
-        for (; v0.x <= v1.x; ++v0.x) {
-          write_data(color, 2U);
-        }
+    if (pen_color_is_function()) {
+      for (; v0.x <= v1.x; ++v0.x) {
+        drv_pixel_set_color(v0, pen_get_color(v0));
       }
     }
     else {
-      // 256k color mode
-      if (pen_color_is_function()) {
-        for (; v0.x <= v1.x; ++v0.x) {
-          write_data(color_to_head_RGB666(pen_get_color(v0)), 3U);
-        }
-      }
-      else {
-        const std::uint32_t color = color_to_head_RGB666(pen_get_color());
-        for (; v0.x <= v1.x; ++v0.x) {
-          write_data(color, 3U);
-        }
+      span_horz(v0, static_cast<std::uint16_t>(v1.x - v0.x + 1), pen_get_color());
+    }
+  }
+
+
+  /**
+   * Draw a vertical line, width is one pixel, no pen support
+   * \param v0 Start vertex, included in line
+   * \param v1 End vertex, included in line, x component is ignored
+   */
+  virtual void line_vert(vertex_type v0, vertex_type v1) final
+  {
+    // swap y
+    vertex_min_y(v0, v1);
+
+    if (pen_color_is_function()) {
+      for (; v0.y <= v1.y; ++v0.y) {
+        drv_pixel_set_color(v0, pen_get_color(v0));
       }
     }
+    else {
+      span_vert(v0, static_cast<std::uint16_t>(v1.y - v0.y + 1), pen_get_color());
+    }
   }
 
 
@@ -413,19 +472,128 @@ protected:
 
 
 private:
+  /**
+   * Set the GRAM address increment direction (entry mode ID and AM bits)
+   * \param step Physical address step of a written pixel
+   */
+  inline void gram_direction_set(vertex_type step)
+  {
+    if (step == gram_step_) {
+      return;
+    }
+    const std::uint16_t dir = step.x > 0 ? 0x0030U :    // ID = 11, AM = 0: x increment
+                              step.x < 0 ? 0x0020U :    // ID = 10, AM = 0: x decrement
+                              step.y > 0 ? 0x0038U :    // ID = 11, AM = 1: y increment
+                                           0x0018U;     // ID = 01, AM = 1: y decrement
+    entry_mode_ = static_cast<std::uint16_t>((entry_mode_ & ~0x0038U) | dir);
+    write_reg(REG_ENTRY_MODE, entry_mode_);
+    gram_step_ = step;
+  }
+
+
+  /**
+   * Set the physical GRAM address, if it isn't the actual auto incremented address
+   * \param pos Physical GRAM address of the next pixel to write
+   */
+  inline void gram_pos_set(vertex_type pos)
+  {
+    if (gram_pos_ != pos) {
+      write_reg(REG_GRAM_HOR_ADDR, static_cast<std::uint16_t>(pos.x));
+      write_reg(REG_GRAM_VER_ADDR, static_cast<std::uint16_t>(pos.y));
+    }
+    gram_pos_ = pos + gram_step_;
+  }
+
+
+  /**
+   * Clip the logical span to the screen and prepare the GRAM for streaming the span
+   * The GRAM address increment is set to the physical direction of the logical span, so that
+   * rotated spans are streamed as columns without any further address setup
+   * \param start Start vertex of the span, clipped on return
+   * \param length Span length, clipped on return
+   * \param vertical True for a vertical span
+   * \return Number of pixels clipped at the span start, -1 if the span is completely outside the screen
+   */
+  inline std::int16_t span_begin(vertex_type& start, std::uint16_t& length, bool vertical)
+  {
+    std::int16_t& pos  = vertical ? start.y : start.x;
+    const std::int16_t other = vertical ? start.x : start.y;
+    const std::int16_t size  = static_cast<std::int16_t>(vertical ? Screen_Size_Y : Screen_Size_X);
+    const std::int16_t size_other = static_cast<std::int16_t>(vertical ? Screen_Size_X : Screen_Size_Y);
+    if (other < 0 || other >= size_other || pos >= size || !length) {
+      return -1;
+    }
+    std::int16_t end  = static_cast<std::int16_t>(pos + length);
+    std::int16_t skip = 0;
+    if (pos < 0) {
+      skip = static_cast<std::int16_t>(-pos);
+      pos  = 0;
+    }
+    if (end > size) {
+      end = size;
+    }
+    if (end <= pos) {
+      return -1;
+    }
+    length = static_cast<std::uint16_t>(end - pos);
+
+    // set GRAM direction and position
+    gram_direction_set(vertical ? orientation_step_y() : orientation_step_x());
+    const vertex_type phys = orientation_to_physical(start);
+    if (gram_pos_ != phys) {
+      write_reg(REG_GRAM_HOR_ADDR, static_cast<std::uint16_t>(phys.x));
+      write_reg(REG_GRAM_VER_ADDR, static_cast<std::uint16_t>(phys.y));
+    }
+    write_idx(REG_GRAM_DATA);
+    gram_pos_ = { static_cast<std::int16_t>(phys.x + gram_step_.x * length), static_cast<std::int16_t>(phys.y + gram_step_.y * length) };
+    return skip;
+  }
+
+
+  /**
+   * Stream a span in the given color
+   */
+  inline void span_fill(vertex_type start, std::uint16_t length, bool vertical, color::value_type color)
+  {
+    if (span_begin(start, length, vertical) < 0) {
+      return;
+    }
+    const typename format::head_type head_color = format::pack(color);
+    for (; length; --length) {
+      write_data(head_color, pixel_bytes);
+    }
+  }
+
+
+  /**
+   * Stream a span out of a color array
+   */
+  inline void span_copy(vertex_type start, std::uint16_t length, bool vertical, const color::value_type* colors)
+  {
+    const std::int16_t skip = span_begin(start, length, vertical);
+    if (skip < 0) {
+      return;
+    }
+    colors += skip;
+    for (; length; --length) {
+      write_data(format::pack(*colors++), pixel_bytes);
+    }
+  }
+
+
   /**
    * Write index
    * \param idx Register index
    * \param data Data to write
    */
-  inline void write_idx(std::uint8_t idx) const
+  inline void write_idx(std::uint8_t idx)
   {
     switch (interface_mode) {
       case 0U :
       {
         // write to index register with option = 0
         const std::uint8_t data_out[2] = { 0U, idx };
-        io::dev::write(device_handle_, 0U, data_out, 2U, nullptr, 0U);
+        io_.write(0U, data_out, 2U);
         break;
       }
       case 8U :
@@ -456,7 +624,7 @@ private:
    * \param idx Register index
    * \param data Data to write
    */
-  inline void write_reg(std::uint8_t idx, std::uint16_t data) const
+  inline void write_reg(std::uint8_t idx, std::uint16_t data)
   {
     write_idx(idx);         // write index
     write_data(data, 2U);   // write data
@@ -468,14 +636,14 @@ private:
    * \param data data to write
    * \param length: 2: 16 bit, 3: 18 bit data
    */
-  inline void write_data(std::uint32_t data, std::size_t length) const
+  inline void write_data(std::uint32_t data, std::size_t length)
   {
     switch (interface_mode) {
       case 0U : {
         // device interface
         const std::uint8_t data_out[3] = { static_cast<std::uint8_t>(data >> 16U), static_cast<std::uint8_t>(data >> 8U), static_cast<std::uint8_t>(data) };
-        // write to GRAM with option = 1
-        io::dev::write(device_handle_, 1U, &data_out[3U - length], length, nullptr, 0U);
+        // write to GRAM with option = 1, consecutive data is coalesced
+        io_.write(1U, &data_out[3U - length], length);
         break;
       }
       case 8U : {
@@ -511,24 +679,86 @@ private:
   /**
    * Read register
    */
-  inline std::uint16_t read_reg(std::uint8_t idx) const
+  inline std::uint16_t read_reg(std::uint8_t idx)
   {
-    write_idx(idx);                                   // write index
-    return static_cast<std::uint16_t>(read_data());   // read data
+    write_idx(idx);                                     // write index
+    return static_cast<std::uint16_t>(read_data(2U));   // read data
   }
 
 
-  inline std::uint32_t read_data() const
+  /**
+   * Read a pixel from GRAM, the GRAM address and index must be set before
+   * The first GRAM read after setting the address returns invalid data, so a dummy pixel is read first
+   * eturn Pixel in head format
+   */
+  inline std::uint32_t read_gram()
+  {
+    if (interface_mode == 0U) {
+      // device interface, dummy and pixel are read in one transfer
+      std::uint8_t data_in[2U * pixel_bytes];
+      std::size_t  length = 2U * pixel_bytes;
+      io_.flush();  // pass the buffered writes (index) before reading
+      if (!io::dev::read(io_.handle(), 1U, data_in, length) || (length != 2U * pixel_bytes)) {
+        return 0U;
+      }
+      std::uint32_t data = 0U;
+      for (std::size_t i = pixel_bytes; i < 2U * pixel_bytes; ++i) {
+        data = (data << 8U) | data_in[i];
+      }
+      return data;
+    }
+    (void)read_data(pixel_bytes);   // dummy read
+    return read_data(pixel_bytes);
+  }
+
+
+  /**
+   * Read data
+   * \param length: 2: 16 bit, 3: 18 bit data
+   * eturn Data
+   */
+  inline std::uint32_t read_data(std::size_t length)
   {
+    std::uint32_t data = 0U;
     switch (interface_mode) {
-      case 0U :
-        // read data from GRAM with option = 1U
-//        io::dev::read(device_handle_, 1U, data, length);
+      case 0U : {
+        // device interface, read data with option = 1
+        std::uint8_t data_in[3];
+        std::size_t  count = length;
+        io_.flush();  // pass the buffered writes (index) before reading
+        if (io::dev::read(io_.handle(), 1U, data_in, count) && (count == length)) {
+          for (std::size_t i = 0U; i < length; ++i) {
+            data = (data << 8U) | data_in[i];
+          }
+        }
+        break;
+      }
+      case 8U :
+        // 8 bit memory interface
+        for (std::size_t i = 0U; i < length; ++i) {
+          data = (data << 8U) | io::mem::read<std::uint8_t>(mem_data_addr_);
+        }
+        break;
+      case 9U :
+        // 9 bit memory interface
+        data  = static_cast<std::uint32_t>(io::mem::read<std::uint16_t>(mem_data_addr_) & 0x01FFU) << 9U;
+        data |= io::mem::read<std::uint16_t>(mem_data_addr_) & 0x01FFU;
+        break;
+      case 16U :
+        // 16 bit memory interface
+        if (length == 3U) {
+          data = static_cast<std::uint32_t>(io::mem::read<std::uint16_t>(mem_data_addr_)) << 16U;
+        }
+        data |= io::mem::read<std::uint16_t>(mem_data_addr_);
+        break;
+      case 18U :
+        // 18 (32) bit memory interface
+        data = io::mem::read<std::uint32_t>(mem_data_addr_);
         break;
       default :
         break;
     }
-    return 0U;
+    return data;
   }
 
 };
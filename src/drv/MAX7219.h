@@ -85,6 +85,7 @@ public:
           0, 0,                             // no viewport support
           orientation)
     , device_handle_(device_handle)
+    , shown_valid_(false)
   { }
 
 
@@ -102,10 +103,8 @@ protected:
 
   virtual void drv_init() final
   {
-    // set scan limit according to width or height
-    write(REG_SCANLIMIT, (orientation_ == orientation_0)  || (orientation_ == orientation_180) ||
-                         (orientation_ == orientation_0m) || (orientation_ == orientation_180m) ?
-                         static_cast<std::uint8_t>(screen_height() - 1U) : static_cast<std::uint8_t>(screen_width() - 1U));
+    // scan all digits, the rotated/mirrored block may occupy any of the 8 digit rows
+    write(REG_SCANLIMIT, 0x07U);
 
     // set no decode
     write(REG_DECODE, 0x00U);
@@ -116,6 +115,9 @@ protected:
     // no test mode
     write(REG_TEST, 0x00U);
 
+    // the digit registers are unknown, write all of them
+    shown_valid_ = false;
+
     // clear buffer
     drv_cls();
 
@@ -189,71 +191,18 @@ protected:
 
   virtual void drv_present() final
   {
-    // copy memory bitmap to screen
-    switch (orientation_) {
-      case orientation_0 :
-        for (std::int16_t y = 0; y < viewport_height(); ++y) {
-          write(REG_DIGIT0 + y, digit_[viewport_get().y + y]);
-        }
-        break;
-      case orientation_90 :
-        for (std::int16_t y = 0; y < viewport_height(); ++y) {
-          std::uint8_t data = 0U;
-          for (std::int16_t x = 0; x < viewport_width(); ++x) {
-            data >>= 1U;
-            data |= (digit_[viewport_get().y + x] & (0x80U >> y)) ? 0x80U : 0x00U;
-          }
-          write(REG_DIGIT0 + y, data);
-        }
-        break;
-      case orientation_180 :
-        for (std::int16_t y = 0; y < viewport_height(); ++y) {
-          write(REG_DIGIT0 + y, util::byte_reverse(digit_[viewport_get().y + viewport_height() - y - 1]));
-        }
-        break;
-      case orientation_270 :
-        for (std::int16_t y = 0; y < viewport_height(); ++y) {
-          std::uint8_t data = 0U;
-          for (std::int16_t x = 0; x < viewport_width(); ++x) {
-            data <<= 1U;
-            data |= (digit_[viewport_get().y + x] & (0x01U << y)) ? 0x01U : 0x00U;
-          }
-          write(REG_DIGIT0 + y, data);
-        }
-        break;
-      case orientation_0m :
-        for (std::int16_t y = 0; y < viewport_height(); ++y) {
-          write(REG_DIGIT0 + y, digit_[viewport_get().y + viewport_height() - y - 1]);
-        }
-        break;
-      case orientation_90m :
-        for (std::int16_t y = 0U; y < viewport_height(); ++y) {
-          std::uint8_t data = 0U;
-          for (std::int16_t x = 0; x < viewport_width(); ++x) {
-            data >>= 1U;
-            data |= (digit_[viewport_get().y + x] & (0x01U << y)) ? 0x80U : 0x00U;
-          }
-          write(REG_DIGIT0 + y, data);
-        }
-        break;
-      case orientation_180m :
-        for (std::int16_t y = 0; y < viewport_height(); ++y) {
-          write(REG_DIGIT0 + y, util::byte_reverse(digit_[viewport_get().y + y]));
-        }
-        break;
-      case orientation_270m :
-        for (std::int16_t y = 0; y < viewport_height(); ++y) {
-          std::uint8_t data = 0U;
-          for (std::int16_t x = 0; x < viewport_width(); ++x) {
-            data <<= 1U;
-            data |= (digit_[viewport_get().y + x] & (0x80U >> y)) ? 0x01U : 0x00U;
-          }
-          write(REG_DIGIT0 + y, data);
-        }
-        break;
-      default:
-        break;
+    // rotate/mirror the visible 8x8 block at once and copy it to the screen
+    const std::uint16_t rows = viewport_height() < 8U ? viewport_height() : 8U;
+    std::uint8_t data[8];
+    util::bit_store_8x8(data, orientation_to_physical_8x8(util::bit_load_8x8(&digit_[viewport_get().y], rows)));
+    for (std::uint_fast8_t y = 0U; y < 8U; ++y) {
+      // only changed digits are written
+      if (!shown_valid_ || (shown_[y] != data[y])) {
+        write(static_cast<std::uint8_t>(REG_DIGIT0 + y), data[y]);
+        shown_[y] = data[y];
+      }
     }
+    shown_valid_ = true;
   }
 
 
@@ -280,6 +229,8 @@ private:
 private:
   const io::dev::handle_type  device_handle_;           // (SPI) device handle
   std::uint8_t                digit_[Screen_Size_Y];    // display buffer, cause MAX7219 doesn't support reading data back
+  std::uint8_t                shown_[8];                // digit registers as last written
+  bool                        shown_valid_;             // shown_ matches the digit registers
 };
 
 } // namespace head
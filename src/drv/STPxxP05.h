@@ -52,7 +52,8 @@ namespace head {
 
 /**
  * STPxxP05 head is a monochrome LED driver, using 1 bit color depth
- * \param Screen_Size_X Screen (buffer) width
+ * Each channel byte of the chip drives one (physical) row of 8 LEDs
+ * \param Screen_Size_X Screen (buffer) width, max. 8
  * \param Screen_Size_Y Screen (buffer) height
  * \param Viewport_Size_X Viewport (window) width
  * \param Viewport_Size_Y Viewport (window) height
@@ -69,23 +70,19 @@ public:
 
   /**
    * ctor
-   * \param xsize Screen width
-   * \param ysize Screen height
-   * \param xoffset X offset of the screen, relative to top/left corner
-   * \param yoffset Y offset of the screen, relative to top/left corner
-   * \param spi_device_id Logical SPI bus device ID
+   * \param orientation Screen orientation
+   * \param device_handle Logical SPI bus device handle
+   * \param viewport_x X offset of the viewport, relative to top/left corner
+   * \param viewport_y Y offset of the viewport, relative to top/left corner
    */
-  STPxxP05(orientation_type orientation, device_handle_type device_handle,
-           std::uint16_t viewport_x = 0U, std::uint16_t viewport_y = 0U)
+  STPxxP05(orientation_type orientation, io::dev::handle_type device_handle,
+           std::int16_t viewport_x = 0, std::int16_t viewport_y = 0)
     : drv(Screen_Size_X,   Screen_Size_Y,
-          Viewport_Size_Y, Viewport_Size_Y,
+          Viewport_Size_X, Viewport_Size_Y,
           viewport_x,      viewport_y,
           orientation)
     , device_handle_(device_handle)
-  {
-    // clear buffer
-    cls();
-  }
+  { }
 
 
   /**
@@ -94,108 +91,89 @@ public:
    */
   ~STPxxP05()
   {
-    shutdown();
+    drv_shutdown();
   }
 
 
-  // driver init
-  virtual void init()
-  { }
+protected:
+
+  virtual void drv_init() final
+  {
+    drv_cls();
+  }
 
 
-  // driver shutdown
-  virtual void shutdown()
+  virtual void drv_shutdown() final
   {
-    cls();
+    drv_cls();
   }
 
 
-  // get driver name and version
-  virtual const char* version() const
+  inline virtual const char* drv_version() const final
   {
     return (const char*)VIC_DRV_STPXXP05_VERSION;
   }
 
 
-  virtual bool is_graphic() const
+  inline virtual bool drv_is_graphic() const final
   {
     // STPxxP05 is a graphic display
     return true;
   }
 
 
-  // clear display, all pixels off (black)
-  virtual void cls()
+  virtual void drv_cls() final
   {
     // clear display
-    for (std::uint_fast8_t i = 0; i < BYTE_COUNT; ++i) {
+    for (std::uint_fast16_t i = 0U; i < Screen_Size_Y; ++i) {
       buffer_[i] = 0U;
     }
+    drv_present();
   }
 
 
-  // rendering done (copy RAM / frame buffer to screen)
-  virtual void primitive_done()
-  {
-    // write buffer to SPI
-    write();
-  }
-
-
-  virtual void drv_pixel_set_color(std::int16_t x, std::int16_t y, color::value_type color)
+  virtual void drv_pixel_set_color(vertex_type point, color::value_type color) final
   {
     // check limits and clipping
-    if (x >= screen_width() || y >= screen_height() || (clipping_ && !clipping_->is_clipping(x, y))) {
+    if (!screen_is_inside(point) || (!clipping_.is_inside(point))) {
       // out of bounds or outside clipping region
       return;
     }
 
     // set pixel in display buffer
     if (color_to_head_L1(color)) {
-      buffer_[y] |= static_cast<std::uint8_t>(0x01U << (x & 0x07U));    // set pixel
+      buffer_[point.y] |= static_cast<std::uint8_t>(0x01U << (point.x & 0x07U));    // set pixel
     }
     else {
-      buffer_[y] &= static_cast<std::uint8_t>(~(0x01U << (x & 0x07U))); // clear pixel
+      buffer_[point.y] &= static_cast<std::uint8_t>(~(0x01U << (point.x & 0x07U))); // clear pixel
     }
   }
 
 
-  virtual color::value_type pixel_get(std::int16_t x, std::int16_t y) const
+  virtual inline color::value_type drv_pixel_get(vertex_type point) final
   {
     // check limits
-    if (x >= screen_width() || y >= screen_height()) {
+    if (!screen_is_inside(point)) {
       // out of bounds
       return color_from_head_L1(0U);
     }
-
-    return color_from_head_L1((buffer_[y] >> (x & 0x07U)) & 0x01U);
+    return color_from_head_L1(static_cast<std::uint8_t>(buffer_[point.y] >> (point.x & 0x07U)) & 0x01U);
   }
 
 
-private:
-  /**
-   * Write data to SPI
-   * \return True if successful
-   */
-  bool write()
+  virtual void drv_present() final
   {
-    if (primitive_lock_) {
-      return;
-    }
-
-    // copy memory bitmap to screen
-    switch (orientation_) {
-      case orientation_0 :
-        return io::dev_set(spi_device_id_, buffer_, Byte_Count, nullptr, 0U);
-      // TBD: all other orientations
-      default :
-        break;
-    }
+    // rotate/mirror the visible 8x8 block at once and shift the channel bytes out
+    const std::uint16_t rows = (viewport_height() < 8U) ? viewport_height() : 8U;
+    std::uint8_t data[8];
+    util::bit_store_8x8(data, orientation_to_physical_8x8(util::bit_load_8x8(&buffer_[viewport_get().y], rows)));
+    io::dev::write(device_handle_, 0U, data, Byte_Count, nullptr, 0U);
   }
 
+
 private:
-  device_handle_type  device_handle_;       // Logical SPI device ID
-  std::uint8_t        buffer_[Byte_Count];  // display buffer, cause reading data isn't supported
+  const io::dev::handle_type  device_handle_;             // (SPI) device handle
+  std::uint8_t                buffer_[Screen_Size_Y];     // display buffer, cause reading data isn't supported
 };
 
 } // namespace head
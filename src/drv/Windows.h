@@ -464,9 +464,9 @@ protected:
 
   /**
    * Output a single ASCII/UNICODE char at the actual cursor position
-   * \param ch Output character in 16 bit ASCII/UNICODE (NOT UTF-8) format, 00-7F is compatible with ASCII
+   * \param ch Output character in 21 bit ASCII/UNICODE (NOT UTF-8) format, 00-7F is compatible with ASCII
    */
-  inline virtual void text_char(std::uint16_t ch) final
+  inline virtual void text_char(std::uint32_t ch) final
   {
     if (ch < 0x20U) {
       // ignore non characters
@@ -475,7 +475,8 @@ protected:
 
     // check limits
     if (screen_is_inside({ text_x_act_, text_y_act_ })) {
-      frame_buffer_[text_x_act_][text_y_act_] = ch;
+      // the frame buffer holds UTF-16 chars, chars outside the BMP are replaced
+      frame_buffer_[text_x_act_][text_y_act_] = static_cast<std::uint16_t>(ch < 0x10000U ? ch : 0xFFFDU);
     }
 
     // always increment the text position
@@ -139,7 +139,7 @@ public:
    * \param ch Output character in ASCII/UNICODE (NOT UTF-8) format
    * \return The x size (distance) of the rendered char
    */
-  virtual std::uint16_t text_char(std::uint16_t ch)
+  virtual std::uint16_t text_char(std::uint32_t ch)
   { }
 
   virtual void drv_present()
@@ -58,11 +58,14 @@ public:
 
   /**
    * ctor
-   * \param head The bound head
+   * \param head The bound head, used in its physical orientation
+   * \param orientation Orientation of the framebuffer (screen) relative to the bound head
    */
-  framebuffer(drv& head)
+  framebuffer(drv& head, orientation_type orientation = orientation_0)
     : drv(Screen_Size_X, Screen_Size_Y,
-          Screen_Size_X, Screen_Size_Y)
+          Screen_Size_X, Screen_Size_Y,
+          0, 0,
+          orientation)
     , head_(head)
     , plane_active_(0U)
     , plane_display_(0U)
@@ -138,7 +141,7 @@ protected:
 
     // to head
     if (plane_display_ == plane_active_) {
-      head_.pixel_set(point, color);
+      head_.pixel_set(orientation_to_physical(point), color);
     }
   }
 
@@ -178,7 +181,7 @@ protected:
       // present the new active plane
       for (std::int16_t y = 0U; y < Screen_Size_Y; ++y) {
         for (std::int16_t x = 0U; x < Screen_Size_X; ++x) {
-          head_.pixel_set({ x, y }, buffer_[plane_display_][x][y]);
+          head_.pixel_set(orientation_to_physical({ x, y }), buffer_[plane_display_][x][y]);
         }
       }
       head_.present();
@@ -205,7 +208,7 @@ protected:
 private:
 
   color::value_type buffer_[Plane_Count][Screen_Size_X][Screen_Size_Y];
-  const drv&        head_;
+  drv&              head_;
   std::size_t       plane_active_;
   std::size_t       plane_display_;
 };
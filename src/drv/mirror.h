@@ -0,0 +1,563 @@
+///////////////////////////////////////////////////////////////////////////////
+// \author (c) Marco Paland (info@paland.com)
+//             2014-2017, PALANDesign Hannover, Germany
+//
+// \license The MIT License (MIT)
+//
+// This file is part of the vic library.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// \brief Mirror driver, renders once and outputs to any number of identical heads.
+// Use this driver if the same content is shown on more displays, like a driver and
+// a passenger facing copy of an instrument display.
+// All primitives are rendered once by the mirror. Pixels, spans (and so blits and text)
+// are broadcast to the heads, lines, boxes and moves are forwarded to the heads, so the
+// heads can render them in display hardware/firmware (if supported). Pixels are read back
+// from the first head. The heads are presented by the mirror only.
+// Every head converts the ARGB spans into its own color format in its span functions.
+// A head with a different orientation is bound by an orientation_adapter.
+// If the worker pool is enabled (VIC_WORKER_POOL_THREADS), the heads are initialized and
+// presented concurrently, this requires heads on independent buses.
+//
+// Usage (show the same screen on two heads, the second one is mounted upside down):
+// vic::head::ILI9325<240U, 320U> _panel1(device_handle1, nullptr, nullptr, false);
+// vic::head::ILI9325<240U, 320U> _panel2(device_handle2, nullptr, nullptr, false);
+// vic::head::orientation_adapter _head2(_panel2, vic::drv::orientation_180);
+// vic::head::mirror<240U, 320U, 2U> _mirror = { _panel1, _head2 };
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _VIC_DRV_MIRROR_H_
+#define _VIC_DRV_MIRROR_H_
+
+#include "../drv.h"
+#include "../worker_pool.h"
+#include <initializer_list>
+
+
+// defines the driver name and version
+#define VIC_DRV_MIRROR_VERSION   "Mirror driver 1.00"
+
+
+namespace vic {
+namespace head {
+
+
+/**
+ * Mirror driver class
+ * \param Screen_Size_X Screen width, all heads must have at least this width
+ * \param Screen_Size_Y Screen height, all heads must have at least this height
+ * \param HEAD_COUNT Number of used heads, all heads MUST be initialized in ctor!
+ */
+template<std::uint16_t Screen_Size_X, std::uint16_t Screen_Size_Y,
+         std::size_t HEAD_COUNT>
+  class mirror : public drv
+{
+  drv*  head_[HEAD_COUNT];  // registered heads
+  bool  is_graphic_;        // true if this is a graphic head, false for alpha numeric mirror
+
+public:
+
+  /**
+   * Head definition for initializer list of ctor
+   */
+  typedef struct tag_head_type {
+    drv&        head;       // reference to head
+
+    tag_head_type(drv& _head)
+      : head(_head)
+    { }
+  } head_type;
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // M A N D A T O R Y   F U N C T I O N S
+
+  /**
+   * ctor
+   * \param il Initializer list of heads, like head::mirror<240U, 320U, 2U> _mirror = { _head0, _head1 };
+   */
+  mirror(const std::initializer_list<head_type>& il)
+    : drv(Screen_Size_X, Screen_Size_Y,
+          Screen_Size_X, Screen_Size_Y)
+  {
+    std::size_t n = 0U;
+    for (typename std::initializer_list<head_type>::iterator it = il.begin(); it != il.end(); ++it) {
+      head_[n] = &it->head;
+      head_[n++]->present_lock();   // forwarded primitives must not present the head
+    }
+
+    // eval graphic/text info of all heads
+    is_graphic_ = false;
+    for (std::size_t i = 0U; i < HEAD_COUNT; ++i) {
+      is_graphic_ |= head_[i]->drv_is_graphic();
+    }
+
+    // the heads are presented in the dtor, so the pool must outlive this driver
+    worker_pool::create();
+  }
+
+
+  /**
+   * dtor
+   * The heads are unlocked again, so they can be used on their own
+   */
+  ~mirror()
+  {
+    for (std::size_t i = 0U; i < HEAD_COUNT; ++i) {
+      head_[i]->present_lock(false);
+    }
+    drv_shutdown();
+  }
+
+
+protected:
+
+  // driver init
+  inline virtual void drv_init()
+  {
+    // init all heads, concurrently if the worker pool is enabled
+    worker_pool::run(HEAD_COUNT, &mirror::job_init, this);
+  }
+
+
+  // driver shutdown
+  inline virtual void drv_shutdown()
+  {
+    for (std::size_t i = 0U; i < HEAD_COUNT; ++i) {
+      head_[i]->drv_shutdown();
+    }
+  }
+
+
+  // get driver name and version
+  inline virtual const char* drv_version() const final
+  {
+    return (const char*)VIC_DRV_MIRROR_VERSION;
+  }
+
+
+  inline virtual bool drv_is_graphic() const final
+  {
+    return is_graphic_;
+  }
+
+
+  // clear display, all pixels off (black)
+  inline virtual void drv_cls()
+  {
+    for (std::size_t i = 0U; i < HEAD_COUNT; ++i) {
+      head_[i]->drv_cls();
+    }
+  }
+
+
+  // rendering done (copy RAM / frame buffer to screen)
+  inline virtual void drv_present()
+  {
+    // present all heads, concurrently if the worker pool is enabled
+    worker_pool::run(HEAD_COUNT, &mirror::job_present, this);
+  }
+
+
+  /**
+   * Set pixel in given color on all heads
+   * \param point Pixel coordinates
+   * \param color Color of pixel in ARGB format
+   */
+  inline virtual void drv_pixel_set_color(vertex_type point, color::value_type color)
+  {
+    // check limits and clipping
+    if (!screen_is_inside(point) || (!clipping_.is_inside(point))) {
+      // out of bounds or outside clipping region
+      return;
+    }
+    for (std::size_t i = 0U; i < HEAD_COUNT; ++i) {
+      head_[i]->drv_pixel_set_color(point, color);
+    }
+  }
+
+
+  /**
+   * Return the color of the pixel, all heads show the same content, so the first head is read
+   * \param point Coordinates of the pixel
+   * \return Color of pixel in ARGB format
+   */
+  inline virtual color::value_type drv_pixel_get(vertex_type point)
+  {
+    return screen_is_inside(point) ? head_[0]->drv_pixel_get(point) : color::black;
+  }
+
+
+public:
+
+  /**
+   * Set display brightness or backlight of all heads
+   * \param level Brightness level
+   */
+  virtual void brightness_set(std::uint8_t level)
+  {
+    for (std::size_t i = 0U; i < HEAD_COUNT; ++i) {
+      head_[i]->brightness_set(level);
+    }
+  }
+
+
+  /**
+   * Enable or disable all heads
+   * \param enable True to enable the display
+   */
+  virtual void display_enable(bool enable = true)
+  {
+    for (std::size_t i = 0U; i < HEAD_COUNT; ++i) {
+      head_[i]->display_enable(enable);
+    }
+  }
+
+
+  ///////////////////////////////////////////////////////////////////////////////
+  // C O L O R   F U N C T I O N S
+
+  /**
+   * Set the drawing color, the heads need it for the forwarded primitives
+   * \param pen_color New drawing color in ARGB format
+   */
+  inline virtual void pen_set_color(color::value_type pen_color)
+  {
+    base::pen_set_color(pen_color);
+    for (std::size_t i = 0U; i < HEAD_COUNT; ++i) {
+      head_[i]->pen_set_color(pen_color);
+    }
+  }
+
+
+  /**
+   * Set the callback function for dynamic pen color
+   * \param pen_color_function Function for dynamic pen color
+   */
+  inline virtual void pen_set_color(pen_color_function_type pen_color_function)
+  {
+    base::pen_set_color(pen_color_function);
+    for (std::size_t i = 0U; i < HEAD_COUNT; ++i) {
+      head_[i]->pen_set_color(pen_color_function);
+    }
+  }
+
+
+  /**
+   * Set the background color (e.g. for cls)
+   * \param background_color New background color in ARGB format
+   */
+  inline virtual void bg_set_color(color::value_type background_color)
+  {
+    base::bg_set_color(background_color);
+    for (std::size_t i = 0U; i < HEAD_COUNT; ++i) {
+      head_[i]->bg_set_color(background_color);
+    }
+  }
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // S P A N S   A N D   P R I M I T I V E S
+
+  /**
+   * Set a horizontal span of pixels in the given color on all heads
+   * \param start Left vertex of the span
+   * \param length Span length in pixel
+   * \param color Color of the span
+   */
+  virtual void span_horz(vertex_type start, std::uint16_t length, color::value_type color)
+  {
+    if (clipping_.is_enabled()) {
+      gpr::span_horz(start, length, color);
+      return;
+    }
+    for (std::size_t i = 0U; i < HEAD_COUNT; ++i) {
+      head_[i]->span_horz(start, length, color);
+    }
+  }
+
+
+  /**
+   * Set a horizontal span of pixels out of a color array on all heads
+   * Blits and text are converted once into ARGB spans, which are passed to all heads
+   * \param start Left vertex of the span
+   * \param length Span length in pixel
+   * \param colors Array of 'length' colors in ARGB format
+   */
+  virtual void span_horz(vertex_type start, std::uint16_t length, const color::value_type* colors)
+  {
+    if (clipping_.is_enabled()) {
+      gpr::span_horz(start, length, colors);
+      return;
+    }
+    for (std::size_t i = 0U; i < HEAD_COUNT; ++i) {
+      head_[i]->span_horz(start, length, colors);
+    }
+  }
+
+
+  /**
+   * Set a vertical span of pixels in the given color on all heads
+   * \param start Top vertex of the span
+   * \param length Span length in pixel
+   * \param color Color of the span
+   */
+  virtual void span_vert(vertex_type start, std::uint16_t length, color::value_type color)
+  {
+    if (clipping_.is_enabled()) {
+      gpr::span_vert(start, length, color);
+      return;
+    }
+    for (std::size_t i = 0U; i < HEAD_COUNT; ++i) {
+      head_[i]->span_vert(start, length, color);
+    }
+  }
+
+
+  /**
+   * Set a vertical span of pixels out of a color array on all heads
+   * \param start Top vertex of the span
+   * \param length Span length in pixel
+   * \param colors Array of 'length' colors in ARGB format
+   */
+  virtual void span_vert(vertex_type start, std::uint16_t length, const color::value_type* colors)
+  {
+    if (clipping_.is_enabled()) {
+      gpr::span_vert(start, length, colors);
+      return;
+    }
+    for (std::size_t i = 0U; i < HEAD_COUNT; ++i) {
+      head_[i]->span_vert(start, length, colors);
+    }
+  }
+
+
+  /**
+   * Draw a horizontal line on all heads
+   * \param v0 Start vertex, included in line
+   * \param v1 End vertex, included in line, y component is ignored
+   */
+  virtual void line_horz(vertex_type v0, vertex_type v1)
+  {
+    if (clipping_.is_enabled()) {
+      // the heads don't know the clipping region
+      gpr::line_horz(v0, v1);
+      return;
+    }
+    for (std::size_t i = 0U; i < HEAD_COUNT; ++i) {
+      head_[i]->line_horz(v0, v1);
+    }
+    present();
+  }
+
+
+  /**
+   * Draw a vertical line on all heads
+   * \param v0 Start vertex, included in line
+   * \param v1 End vertex, included in line, x component is ignored
+   */
+  virtual void line_vert(vertex_type v0, vertex_type v1)
+  {
+    if (clipping_.is_enabled()) {
+      gpr::line_vert(v0, v1);
+      return;
+    }
+    for (std::size_t i = 0U; i < HEAD_COUNT; ++i) {
+      head_[i]->line_vert(v0, v1);
+    }
+    present();
+  }
+
+
+  /**
+   * Draw a box (filled rectangle) on all heads
+   * \param v0 top/left vertex
+   * \param v1 bottom/right vertex
+   */
+  virtual void box(vertex_type v0, vertex_type v1)
+  {
+    if (clipping_.is_enabled()) {
+      gpr::box(v0, v1);
+      return;
+    }
+    for (std::size_t i = 0U; i < HEAD_COUNT; ++i) {
+      head_[i]->box(v0, v1);
+    }
+    present();
+  }
+
+
+  /**
+   * Move display area on all heads
+   * \param source Source top/left vertex
+   * \param destination Destination top/left vertex
+   * \param width Width of the area
+   * \param height Height of the area
+   */
+  virtual void move(vertex_type source, vertex_type destination, std::uint16_t width, std::uint16_t height)
+  {
+    if (clipping_.is_enabled()) {
+      gpr::move(source, destination, width, height);
+      return;
+    }
+    for (std::size_t i = 0U; i < HEAD_COUNT; ++i) {
+      head_[i]->move(source, destination, width, height);
+    }
+    present();
+  }
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // T E X T   F U N C T I O N S
+  // Graphic heads get the rendered text as spans, text heads get the text itself
+
+  /**
+   * Returns the stripe order which all heads have in common
+   * \return Stripe order, text_subpixel_none if the heads differ
+   */
+  virtual text_subpixel_type text_subpixel_order() const
+  {
+    const text_subpixel_type order = head_[0]->text_subpixel_order();
+    for (std::size_t i = 1U; i < HEAD_COUNT; ++i) {
+      if (head_[i]->text_subpixel_order() != order) {
+        return text_subpixel_none;
+      }
+    }
+    return order;
+  }
+
+
+  /**
+   * Select the font
+   * \param font Reference to font to use
+   */
+  inline virtual void text_font_select(const font::font_type& font)
+  {
+    txr::text_font_select(font);
+    if (!is_graphic_) {
+      for (std::size_t i = 0U; i < HEAD_COUNT; ++i) {
+        head_[i]->text_font_select(font);
+      }
+    }
+  }
+
+
+  /**
+   * Select a font set
+   * \param set Font set to use
+   */
+  inline virtual void text_font_set_select(font::font_set& set)
+  {
+    txr::text_font_set_select(set);
+    if (!is_graphic_) {
+      for (std::size_t i = 0U; i < HEAD_COUNT; ++i) {
+        head_[i]->text_font_set_select(set);
+      }
+    }
+  }
+
+
+  /**
+   * Set the text mode
+   * \param mode Set normal, opaque or inverse video
+   */
+  inline virtual void text_mode(text_mode_type mode)
+  {
+    txr::text_mode(mode);
+    if (!is_graphic_) {
+      for (std::size_t i = 0U; i < HEAD_COUNT; ++i) {
+        head_[i]->text_mode(mode);
+      }
+    }
+  }
+
+
+  /**
+   * Set the new text position
+   * \param pos Position in pixel on graphic displays, position in chars on text displays
+   */
+  inline virtual void text_pos(vertex_type pos)
+  {
+    txr::text_pos(pos);
+    if (!is_graphic_) {
+      for (std::size_t i = 0U; i < HEAD_COUNT; ++i) {
+        head_[i]->text_pos(pos);
+      }
+    }
+  }
+
+
+  /**
+   * Output one character
+   * \param ch Output character in 21 bit UNICODE (NOT UTF-8) format
+   */
+  inline virtual void text_char(std::uint32_t ch)
+  {
+    if (is_graphic_) {
+      // render once
+      txr::text_char(ch);
+      return;
+    }
+    for (std::size_t i = 0U; i < HEAD_COUNT; ++i) {
+      head_[i]->text_char(ch);
+    }
+  }
+
+
+  /**
+   * Render an ASCII/UTF-8 coded string
+   * \param string Output string in ASCII/UTF-8 format, zero terminated
+   * \return Number of written characters, not bytes (as an UTF-8 character may consist out of more bytes)
+   */
+  virtual std::uint16_t text_string(const std::uint8_t* string)
+  {
+    if (is_graphic_) {
+      // render once
+      return txr::text_string(string);
+    }
+    std::uint16_t cnt = 0U;
+    for (std::size_t i = 0U; i < HEAD_COUNT; ++i) {
+      cnt = head_[i]->text_string(string);
+    }
+    present();
+    return cnt;
+  }
+
+
+private:
+
+  // worker pool job, init head 'index'
+  static void job_init(void* context, std::size_t index)
+  {
+    static_cast<mirror*>(context)->head_[index]->drv_init();
+  }
+
+
+  // worker pool job, present head 'index'
+  static void job_present(void* context, std::size_t index)
+  {
+    static_cast<mirror*>(context)->head_[index]->drv_present();
+  }
+};
+
+} // namespace head
+} // namespace vic
+
+#endif  // _VIC_DRV_MIRROR_H_
@@ -27,8 +27,22 @@
 // more displays to one big logical display.
 // This is handy if you are working with LED matrix grids and you want to combine them
 // to a big screen or video wall.
-// Disadvantage: All rendering is done by the gpr, not in display hardware/firmware (if
-// supported). Only pixel_set() and pixel_get() is used of the display drivers
+// Horizontal and vertical lines, boxes and moves are clipped to the heads and forwarded in
+// head local coordinates, so the heads can render them in display hardware/firmware (if
+// supported). All other primitives are rendered by the gpr, their pixels and spans are
+// passed to the heads. The heads are presented by the multihead only, present() presents
+// just the heads which were touched since the last present.
+// Text is measured by the multihead, every head gets only the chars which fall on it, at
+// head local positions: graphic heads the chars whose glyph box overlaps the head, text
+// heads the substring of every line which is on the head.
+// If the worker pool is enabled (VIC_WORKER_POOL_THREADS), the heads are initialized and
+// presented concurrently, this requires heads on independent buses.
+// Pixels, spans and boxes are routed by a band table, which is built in the ctor: all head
+// viewport edges divide the screen into x and y bands, each band cell is covered by one head.
+// A pixel is routed in O(1), spans and boxes are split into per head pieces in one pass.
+// Overlapping viewports are routed to the head which comes first in the initializer list.
+// The table needs Screen_Size_X + Screen_Size_Y + (2 * HEAD_COUNT + 1)^2 bytes, the band
+// indices of the columns and rows take 2 bytes each with more than 127 heads.
 //
 // Usage (create a display out of 4 heads in a row):
 // vic::head::dummy<200U, 200U> _head1;
@@ -43,6 +57,7 @@
 #define _VIC_DRV_MULTIHEAD_H_
 
 #include "../drv.h"
+#include "../worker_pool.h"
 #include <initializer_list>
 
 
@@ -54,6 +69,11 @@ namespace vic {
 namespace head {
 
 
+// band index type of the multihead band table, 8 bit up to 256 bands per direction
+template<bool Wide> struct multihead_band_select { typedef std::uint8_t type; };
+template<> struct multihead_band_select<true>    { typedef std::uint16_t type; };
+
+
 /**
  * Multihead driver class
  * \param Screen_Size_X (Virtual) screen width
@@ -65,12 +85,24 @@ template<std::uint16_t Screen_Size_X, std::uint16_t Screen_Size_Y,
   class multihead : public drv
 {
   typedef struct tag_multihead_head_type {
-    multihead*    head;
+    drv*          head;
     vertex_type   viewport;
+    bool          dirty;      // head was touched since the last present
   } multihead_head_type;
 
-  multihead_head_type head_[HEAD_COUNT];  // registered heads
-  bool                is_graphic_;        // true if this is a graphic head, false for alpha numeric multihead
+  // count of bands per direction, all viewport edges and the screen borders delimit the bands
+  static const std::size_t BAND_COUNT = 2U * HEAD_COUNT + 1U;
+  typedef typename multihead_band_select<(BAND_COUNT > 256U)>::type band_type;
+
+  multihead_head_type head_[HEAD_COUNT];              // registered heads
+  bool                is_graphic_;                    // true if this is a graphic head, false for alpha numeric multihead
+  band_type           band_x_[Screen_Size_X];         // x band of every screen column
+  band_type           band_y_[Screen_Size_Y];         // y band of every screen row
+  std::int16_t        edge_x_[BAND_COUNT + 1U];       // left edge of the x bands, followed by the screen width
+  std::int16_t        edge_y_[BAND_COUNT + 1U];       // top edge of the y bands, followed by the screen height
+  std::uint8_t        route_[BAND_COUNT][BAND_COUNT]; // head index of every band cell [y][x], HEAD_COUNT if no head covers it
+
+  static_assert(HEAD_COUNT < 255U, "multihead supports up to 254 heads");
 
 public:
 
@@ -100,8 +132,10 @@ public:
   {
     std::size_t n = 0U;
     for (typename std::initializer_list<head_type>::iterator it = il.begin(); it != il.end(); ++it) {
-      head_[n].head       = reinterpret_cast<multihead*>(&it->head);
-      head_[n++].viewport = it->viewport;
+      head_[n].head       = &it->head;
+      head_[n].viewport   = it->viewport;
+      head_[n].dirty      = true;
+      head_[n++].head->present_lock();    // forwarded primitives must not present the head
     }
 
     // eval graphic/text info of all heads
@@ -109,14 +143,23 @@ public:
     for (std::size_t i = 0U; i < HEAD_COUNT; ++i) {
       is_graphic_ |= head_[i].head->drv_is_graphic();
     }
+
+    // the heads are presented in the dtor, so the pool must outlive this driver
+    worker_pool::create();
+
+    route_init();
   }
 
 
   /**
    * dtor
+   * The heads are unlocked again, so they can be used on their own
    */
   ~multihead()
   {
+    for (std::size_t i = 0U; i < HEAD_COUNT; ++i) {
+      head_[i].head->present_lock(false);
+    }
     drv_shutdown();
   }
 
@@ -126,10 +169,8 @@ protected:
   // driver init
   inline virtual void drv_init()
   {
-    // init all heads
-    for (std::size_t i = 0U; i < HEAD_COUNT; ++i) {
-      head_[i].head->drv_init();
-    }
+    // init all heads, concurrently if the worker pool is enabled
+    worker_pool::run(HEAD_COUNT, &multihead::job_init, this);
   }
 
 
@@ -162,6 +203,7 @@ protected:
     // clear all heads
     for (std::size_t i = 0U; i < HEAD_COUNT; ++i) {
       head_[i].head->drv_cls();
+      head_[i].dirty = true;
     }
   }
 
@@ -169,10 +211,8 @@ protected:
   // rendering done (copy RAM / frame buffer to screen)
   inline virtual void drv_present()
   {
-    // call present of all heads
-    for (std::size_t i = 0U; i < HEAD_COUNT; ++i) {
-      head_[i].head->drv_present();
-    }
+    // present the heads which were touched since the last present, concurrently if the worker pool is enabled
+    worker_pool::run(HEAD_COUNT, &multihead::job_present, this);
   }
 
 
@@ -222,13 +262,9 @@ protected:
    */
   inline virtual color::value_type pen_get_color(vertex_type point) const
   {
-    // select to right head and read the pixel
-    for (std::size_t i = 0U; i < HEAD_COUNT; ++i) {
-      if (head_[i].head->screen_is_inside({ static_cast<std::int16_t>(point.x - head_[i].viewport.x), static_cast<std::int16_t>(point.y - head_[i].viewport.y) })) {
-        return head_[i].head->pen_get_color({ static_cast<std::int16_t>(point.x - head_[i].viewport.x), static_cast<std::int16_t>(point.y - head_[i].viewport.y) });
-      }
-    }
-    return base::pen_get_color(point);
+    // select the right head and get its color
+    const std::size_t i = route(point);
+    return (i < HEAD_COUNT) ? head_[i].head->pen_get_color(route_local(i, point)) : base::pen_get_color(point);
   }
 
 
@@ -261,11 +297,11 @@ protected:
       return;
     }
 
-    // select to right head and set the pixel
-    for (std::size_t i = 0U; i < HEAD_COUNT; ++i) {
-      if (head_[i].head->screen_is_inside({ static_cast<std::int16_t>(point.x - head_[i].viewport.x), static_cast<std::int16_t>(point.y - head_[i].viewport.y) })) {
-        head_[i].head->drv_pixel_set_color({ static_cast<std::int16_t>(point.x - head_[i].viewport.x), static_cast<std::int16_t>(point.y - head_[i].viewport.y) }, color);
-      }
+    // select the right head and set the pixel
+    const std::size_t i = route(point);
+    if (i < HEAD_COUNT) {
+      head_[i].head->drv_pixel_set_color(route_local(i, point), color);
+      head_[i].dirty = true;
     }
   }
 
@@ -277,14 +313,9 @@ protected:
    */
   inline virtual color::value_type drv_pixel_get(vertex_type point)
   {
-    // select to right head and read the pixel
-    for (std::size_t i = 0U; i < HEAD_COUNT; ++i) {
-      if (head_[i].head->screen_is_inside({ static_cast<std::int16_t>(point.x - head_[i].viewport.x), static_cast<std::int16_t>(point.y - head_[i].viewport.y) })) {
-        return head_[i].head->drv_pixel_get({ static_cast<std::int16_t>(point.x - head_[i].viewport.x), static_cast<std::int16_t>(point.y - head_[i].viewport.y) });
-      }
-    }
-    // pixel not found
-    return color::black;
+    // select the right head and read the pixel
+    const std::size_t i = route(point);
+    return (i < HEAD_COUNT) ? head_[i].head->drv_pixel_get(route_local(i, point)) : color::black;
   }
 
 
@@ -294,15 +325,143 @@ protected:
    */
   inline virtual void pixel_set(vertex_type point)
   {
-    // select to right head and set the pixel
-    for (std::size_t i = 0U; i < HEAD_COUNT; ++i) {
-      if (head_[i].head->screen_is_inside({ static_cast<std::int16_t>(point.x - head_[i].viewport.x), static_cast<std::int16_t>(point.y - head_[i].viewport.y) })) {
-        head_[i].head->pixel_set({ static_cast<std::int16_t>(point.x - head_[i].viewport.x), static_cast<std::int16_t>(point.y - head_[i].viewport.y) });
-      }
+    // check clipping
+    if (!clipping_.is_inside(point)) {
+      // outside clipping region
+      return;
+    }
+
+    // select the right head and set the pixel
+    const std::size_t i = route(point);
+    if (i < HEAD_COUNT) {
+      head_[i].head->pixel_set(route_local(i, point));
+      head_[i].dirty = true;
     }
   }
 
 
+  /////////////////////////////////////////////////////////////////////////////
+  // S P A N S   A N D   P R I M I T I V E S
+
+  /**
+   * Set a horizontal span of pixels in the given color, the span is split into one piece per head
+   * \param start Left vertex of the span
+   * \param length Span length in pixel
+   * \param color Color of the span
+   */
+  virtual void span_horz(vertex_type start, std::uint16_t length, color::value_type color)
+  {
+    route_span<true>(start, length, color);
+  }
+
+
+  /**
+   * Set a horizontal span of pixels out of a color array, the span is split into one piece per head
+   * \param start Left vertex of the span
+   * \param length Span length in pixel
+   * \param colors Array of 'length' colors in ARGB format
+   */
+  virtual void span_horz(vertex_type start, std::uint16_t length, const color::value_type* colors)
+  {
+    route_span<true>(start, length, colors);
+  }
+
+
+  /**
+   * Set a vertical span of pixels in the given color, the span is split into one piece per head
+   * \param start Top vertex of the span
+   * \param length Span length in pixel
+   * \param color Color of the span
+   */
+  virtual void span_vert(vertex_type start, std::uint16_t length, color::value_type color)
+  {
+    route_span<false>(start, length, color);
+  }
+
+
+  /**
+   * Set a vertical span of pixels out of a color array, the span is split into one piece per head
+   * \param start Top vertex of the span
+   * \param length Span length in pixel
+   * \param colors Array of 'length' colors in ARGB format
+   */
+  virtual void span_vert(vertex_type start, std::uint16_t length, const color::value_type* colors)
+  {
+    route_span<false>(start, length, colors);
+  }
+
+
+  /**
+   * Draw a horizontal line, the line is clipped to the heads and forwarded
+   * \param v0 Start vertex, included in line
+   * \param v1 End vertex, included in line, y component is ignored
+   */
+  virtual void line_horz(vertex_type v0, vertex_type v1)
+  {
+    if (!route_is_forwardable()) {
+      gpr::line_horz(v0, v1);
+      return;
+    }
+    route_rect(v0, { v1.x, v0.y }, route_line_horz());
+    present();
+  }
+
+
+  /**
+   * Draw a vertical line, the line is clipped to the heads and forwarded
+   * \param v0 Start vertex, included in line
+   * \param v1 End vertex, included in line, x component is ignored
+   */
+  virtual void line_vert(vertex_type v0, vertex_type v1)
+  {
+    if (!route_is_forwardable()) {
+      gpr::line_vert(v0, v1);
+      return;
+    }
+    route_rect(v0, { v0.x, v1.y }, route_line_vert());
+    present();
+  }
+
+
+  /**
+   * Draw a box (filled rectangle), the box is split into one piece per covered band cell,
+   * each piece is forwarded to its head
+   * \param v0 top/left vertex
+   * \param v1 bottom/right vertex
+   */
+  virtual void box(vertex_type v0, vertex_type v1)
+  {
+    if (!route_is_forwardable()) {
+      gpr::box(v0, v1);
+      return;
+    }
+    route_rect(v0, v1, route_box());
+    present();
+  }
+
+
+  /**
+   * Move display area
+   * The move is forwarded if source and destination are on the same head, otherwise it's done pixel wise
+   * \param source Source top/left vertex
+   * \param destination Destination top/left vertex
+   * \param width Width of the area
+   * \param height Height of the area
+   */
+  virtual void move(vertex_type source, vertex_type destination, std::uint16_t width, std::uint16_t height)
+  {
+    const std::size_t i = route(source);
+    if (clipping_.is_enabled() || !width || !height || (i == HEAD_COUNT) ||
+        !route_is_on_head(i, source, width, height) || !route_is_on_head(i, destination, width, height)) {
+      gpr::move(source, destination, width, height);
+      return;
+    }
+    head_[i].head->move(route_local(i, source), route_local(i, destination), width, height);
+    head_[i].dirty = true;
+    present();
+  }
+
+
   /////////////////////////////////////////////////////////////////////////////
   // F U N C T I O N S   F O R   A L P H A   H E A D S
 
@@ -313,12 +472,26 @@ protected:
    */
   inline virtual void text_font_select(const font::font_type& font)
   {
+    txr::text_font_select(font);  // chars are measured by the multihead
     for (std::size_t i = 0U; i < HEAD_COUNT; ++i) {
       head_[i].head->text_font_select(font);
     }
   }
 
 
+  /**
+   * Select a font set
+   * \param set Font set to use
+   */
+  inline virtual void text_font_set_select(font::font_set& set)
+  {
+    txr::text_font_set_select(set);
+    for (std::size_t i = 0U; i < HEAD_COUNT; ++i) {
+      head_[i].head->text_font_set_select(set);
+    }
+  }
+
+
  /**
   * Set the text mode
   * \param mode Set normal or inverse video
@@ -333,46 +506,432 @@ protected:
 
 
   /**
-   * Set the new text position
-   * \param pos Position in pixel on graphic displays, position in chars on text displays
+   * Enable subpixel rendering, every head renders with its own stripe order
+   * \param enable True to enable subpixel rendering
    */
-  inline virtual void text_pos(vertex_type pos)
+  inline virtual void text_subpixel(bool enable)
   {
-    // set the individual position on every head
     for (std::size_t i = 0U; i < HEAD_COUNT; ++i) {
-      head_[i].head->text_pos({ static_cast<std::int16_t>(pos.x - head_[i].viewport.x), static_cast<std::int16_t>(pos.y - head_[i].viewport.y) });
+      head_[i].head->text_subpixel(enable);
     }
   }
 
 
   /**
-   * Output one character
-   * \param ch Output character in 16 bit UNICODE (NOT UTF-8) format
-   * \return The x size (distance) of the rendered char
+   * Set the new text position, the heads get their positions per char or substring
+   * \param pos Position in pixel on graphic displays, position in chars on text displays
    */
-  inline virtual void text_char(std::uint16_t ch)
+  inline virtual void text_pos(vertex_type pos)
   {
+    txr::text_pos(pos);
+  }
+
+
+  /**
+   * Output one character, the char is passed to the heads which it overlaps
+   * \param ch Output character in 21 bit UNICODE (NOT UTF-8) format
+   */
+  inline virtual void text_char(std::uint32_t ch)
+  {
+    if (ch < 0x20U) {
+      // ignore non characters
+      return;
+    }
+
+    const vertex_type pos = { text_x_act_, text_y_act_ };
+    if (!is_graphic_) {
+      // a char is one cell on text heads
+      text_x_act_++;
+      const std::size_t i = route(pos);
+      if (i < HEAD_COUNT) {
+        head_[i].head->text_pos(route_local(i, pos));
+        head_[i].head->text_char(ch);
+        head_[i].dirty = true;
+      }
+      return;
+    }
+
+    font::glyph_type glyph;
+    if (!text_glyph_get(ch, glyph)) {
+      // char not found
+      return;
+    }
+    text_x_act_ += glyph.xdist;
+
+    // char cell and glyph box, plus the one pixel fringe of subpixel glyphs
+    const vertex_type v0 = { static_cast<std::int16_t>(pos.x + util::min2(glyph.xpos, 0) - 1),
+                             static_cast<std::int16_t>(pos.y + util::min2(glyph.ypos, 0)) };
+    const vertex_type v1 = { static_cast<std::int16_t>(pos.x + util::max2(glyph.xdist, static_cast<std::int16_t>(glyph.xpos + glyph.xsize))),
+                             static_cast<std::int16_t>(pos.y + util::max2(text_font_->ysize, static_cast<std::int16_t>(glyph.ypos + glyph.ysize)) - 1) };
     for (std::size_t i = 0U; i < HEAD_COUNT; ++i) {
-      head_[i].head->text_char(ch);
+      if (route_is_overlapping(i, v0, v1)) {
+        head_[i].head->text_pos(route_local(i, pos));
+        head_[i].head->text_char(ch);
+        head_[i].dirty = true;
+      }
     }
   }
 
 
   /**
    * Render an ASCII/UTF-8 coded string
+   * On text heads every head gets the substring of each line which is on the head
    * \param string Output string in ASCII/UTF-8 format, zero terminated
    * \return Number of written characters, not bytes (as an UTF-8 character may consist out of more bytes)
    */
   virtual std::uint16_t text_string(const std::uint8_t* string)
   {
-    // each graphic head renders its own string
-    std::uint16_t cnt;
-    for (std::size_t i = 0U; i < HEAD_COUNT; ++i) {
-      cnt = head_[i].head->text_string(string);
+    if (is_graphic_) {
+      // the chars are routed by text_char()
+      return txr::text_string(string);
     }
+
+    std::uint32_t ch;
+    std::uint16_t cnt = 0U;
+    for (;;) {
+      // measure the line
+      const std::uint8_t* end = string;
+      std::uint16_t       len = 0U;
+      while (*end && (*end != '\n') && (*end != '\r')) {
+        len = static_cast<std::uint16_t>(len + (text_utf8_next(end, ch) ? 1U : 0U));
+      }
+      for (std::size_t i = 0U; i < HEAD_COUNT; ++i) {
+        text_line_route(i, string, len);
+      }
+      text_x_act_ = static_cast<std::int16_t>(text_x_act_ + len);
+      cnt = static_cast<std::uint16_t>(cnt + len);
+      if (!*end) {
+        break;
+      }
+
+      // LF: X = 0, Y = next line, CR: X = 0
+      text_y_act_ = static_cast<std::int16_t>(text_y_act_ + ((*end == '\n') ? 1 : 0));
+      text_x_act_ = text_x_set_;
+      string = end + 1U;
+      cnt++;
+    }
+    present();
     return cnt;
   }
 
+
+private:
+
+  /////////////////////////////////////////////////////////////////////////////
+  // R O U T I N G
+
+  // worker pool job, init head 'index'
+  static void job_init(void* context, std::size_t index)
+  {
+    multihead_head_type& head = static_cast<multihead*>(context)->head_[index];
+    head.head->drv_init();
+    head.dirty = true;
+  }
+
+
+  // worker pool job, present head 'index' if it was touched
+  static void job_present(void* context, std::size_t index)
+  {
+    multihead_head_type& head = static_cast<multihead*>(context)->head_[index];
+    if (head.dirty) {
+      head.dirty = false;
+      head.head->drv_present();
+    }
+  }
+
+
+  /**
+   * Build the band table out of the head viewports
+   */
+  void route_init()
+  {
+    const std::size_t nx = route_edges(edge_x_, true);
+    const std::size_t ny = route_edges(edge_y_, false);
+
+    // a head covers a band cell completely if it covers the top left pixel of the cell
+    for (std::size_t by = 0U; by < ny - 1U; ++by) {
+      for (std::size_t bx = 0U; bx < nx - 1U; ++bx) {
+        std::size_t i = 0U;
+        while ((i < HEAD_COUNT) && !head_[i].head->screen_is_inside(route_local(i, { edge_x_[bx], edge_y_[by] }))) {
+          ++i;
+        }
+        route_[by][bx] = static_cast<std::uint8_t>(i);
+      }
+    }
+    for (std::size_t bx = 0U; bx < nx - 1U; ++bx) {
+      for (std::int16_t x = edge_x_[bx]; x < edge_x_[bx + 1U]; ++x) {
+        band_x_[x] = static_cast<band_type>(bx);
+      }
+    }
+    for (std::size_t by = 0U; by < ny - 1U; ++by) {
+      for (std::int16_t y = edge_y_[by]; y < edge_y_[by + 1U]; ++y) {
+        band_y_[y] = static_cast<band_type>(by);
+      }
+    }
+  }
+
+
+  /**
+   * Collect the sorted and unique viewport edges of all heads, clipped to the screen
+   * \param edge Edge table to fill, the first edge is 0, the last the screen size
+   * \param x_dir True for the x edges, false for the y edges
+   * \return Number of edges
+   */
+  std::size_t route_edges(std::int16_t* edge, bool x_dir) const
+  {
+    const std::int16_t size = static_cast<std::int16_t>(x_dir ? Screen_Size_X : Screen_Size_Y);
+    std::size_t n = 0U;
+    edge[n++] = 0;
+    edge[n++] = size;
+    for (std::size_t i = 0U; i < HEAD_COUNT; ++i) {
+      const std::int16_t e0 = x_dir ? head_[i].viewport.x : head_[i].viewport.y;
+      const std::int16_t e1 = static_cast<std::int16_t>(e0 + (x_dir ? head_[i].head->screen_width() : head_[i].head->screen_height()));
+      n = route_edge_insert(edge, n, util::min2(util::max2(e0, 0), size));
+      n = route_edge_insert(edge, n, util::min2(util::max2(e1, 0), size));
+    }
+    return n;
+  }
+
+
+  // insert an edge into the sorted edge table, returns the new edge count
+  static std::size_t route_edge_insert(std::int16_t* edge, std::size_t n, std::int16_t e)
+  {
+    std::size_t i = 0U;
+    while ((i < n) && (edge[i] < e)) {
+      ++i;
+    }
+    if ((i < n) && (edge[i] == e)) {
+      return n;
+    }
+    for (std::size_t j = n; j > i; --j) {
+      edge[j] = edge[j - 1U];
+    }
+    edge[i] = e;
+    return n + 1U;
+  }
+
+
+  /**
+   * Returns the head which covers the given screen point
+   * \param point Screen point
+   * \return Index of the head, HEAD_COUNT if no head covers the point
+   */
+  inline std::size_t route(vertex_type point) const
+  {
+    if ((point.x < 0) || (point.y < 0) || (point.x >= static_cast<std::int16_t>(Screen_Size_X)) || (point.y >= static_cast<std::int16_t>(Screen_Size_Y))) {
+      return HEAD_COUNT;
+    }
+    return route_[band_y_[point.y]][band_x_[point.x]];
+  }
+
+
+  // returns the given screen point in local coordinates of head i
+  inline vertex_type route_local(std::size_t i, vertex_type point) const
+  {
+    return { static_cast<std::int16_t>(point.x - head_[i].viewport.x), static_cast<std::int16_t>(point.y - head_[i].viewport.y) };
+  }
+
+
+  // returns true if the area is completely on head i
+  inline bool route_is_on_head(std::size_t i, vertex_type top_left, std::uint16_t width, std::uint16_t height) const
+  {
+    return head_[i].head->screen_is_inside(route_local(i, top_left)) &&
+           head_[i].head->screen_is_inside(route_local(i, { static_cast<std::int16_t>(top_left.x + width - 1), static_cast<std::int16_t>(top_left.y + height - 1) }));
+  }
+
+
+  // returns true if the rectangle v0 (top/left) - v1 (bottom/right) overlaps head i
+  inline bool route_is_overlapping(std::size_t i, vertex_type v0, vertex_type v1) const
+  {
+    const vertex_type l0 = route_local(i, v0);
+    const vertex_type l1 = route_local(i, v1);
+    return (l1.x >= 0) && (l1.y >= 0) &&
+           (l0.x < static_cast<std::int16_t>(head_[i].head->screen_width())) && (l0.y < static_cast<std::int16_t>(head_[i].head->screen_height()));
+  }
+
+
+  /**
+   * Pass the part of a text line which is on text head i to the head
+   * The chars are copied in chunks of VIC_DRV_MULTIHEAD_TEXT_BUFFER_SIZE bytes, so the head gets
+   * zero terminated strings at its own (local) positions
+   * \param i Head index
+   * \param line Line at the actual text position, terminated by zero, CR or LF
+   * \param len Number of chars of the line
+   */
+  void text_line_route(std::size_t i, const std::uint8_t* line, std::uint16_t len)
+  {
+    vertex_type pos = route_local(i, { text_x_act_, text_y_act_ });
+    if ((pos.y < 0) || (pos.y >= static_cast<std::int16_t>(head_[i].head->screen_height()))) {
+      return;
+    }
+    std::int16_t       first = util::max2(static_cast<std::int16_t>(-pos.x), 0);
+    const std::int16_t last  = util::min2(static_cast<std::int16_t>(len), static_cast<std::int16_t>(head_[i].head->screen_width() - pos.x));
+    if (first >= last) {
+      // line isn't on the head
+      return;
+    }
+
+    // skip the chars left of the head
+    std::uint32_t ch;
+    for (std::int16_t n = 0; n < first; ) {
+      n = static_cast<std::int16_t>(n + (text_utf8_next(line, ch) ? 1 : 0));
+    }
+
+    pos.x = static_cast<std::int16_t>(pos.x + first);
+    while (first < last) {
+      std::uint8_t buffer[VIC_DRV_MULTIHEAD_TEXT_BUFFER_SIZE];
+      std::size_t  size = 0U;
+      std::int16_t n    = 0;
+      while (first + n < last) {
+        const std::uint8_t* c = line;
+        if (!text_utf8_next(line, ch)) {
+          // skip unknown sequence
+          continue;
+        }
+        if (size + static_cast<std::size_t>(line - c) >= VIC_DRV_MULTIHEAD_TEXT_BUFFER_SIZE) {
+          // buffer full, char goes into the next chunk
+          line = c;
+          break;
+        }
+        for (; c < line; ++c) {
+          buffer[size++] = *c;
+        }
+        n++;
+      }
+      buffer[size] = 0U;
+      head_[i].head->text_pos(pos);
+      head_[i].head->text_string(buffer);
+      head_[i].dirty = true;
+      first = static_cast<std::int16_t>(first + n);
+      pos.x = static_cast<std::int16_t>(pos.x + n);
+    }
+  }
+
+
+  // returns true if lines and boxes can be forwarded, a pen color function and the clipping region need screen coordinates
+  inline bool route_is_forwardable() const
+  {
+    return !pen_color_is_function() && !clipping_.is_enabled();
+  }
+
+
+  // primitives which are forwarded to the heads
+  struct route_line_horz {
+    inline void operator()(drv& head, vertex_type v0, vertex_type v1) const { head.line_horz(v0, v1); }
+  };
+  struct route_line_vert {
+    inline void operator()(drv& head, vertex_type v0, vertex_type v1) const { head.line_vert(v0, v1); }
+  };
+  struct route_box {
+    inline void operator()(drv& head, vertex_type v0, vertex_type v1) const { head.box(v0, v1); }
+  };
+
+
+  /**
+   * Split a rectangle at the band edges and forward the pieces to the covering heads
+   * \param Primitive Functor which renders a piece on a head
+   * \param v0 Corner vertex
+   * \param v1 Opposite corner vertex
+   * \param primitive Primitive, called with the head and the piece in head local coordinates
+   */
+  template<typename Primitive>
+  void route_rect(vertex_type v0, vertex_type v1, const Primitive& primitive)
+  {
+    // make sure v0 is top/left and clip the rectangle to the screen
+    vertex_top_left(v0, v1);
+    if ((v1.x < 0) || (v1.y < 0) || (v0.x >= static_cast<std::int16_t>(Screen_Size_X)) || (v0.y >= static_cast<std::int16_t>(Screen_Size_Y))) {
+      return;
+    }
+    v0 = { util::max2(v0.x, 0), util::max2(v0.y, 0) };
+    v1 = { util::min2(v1.x, static_cast<std::int16_t>(Screen_Size_X - 1U)), util::min2(v1.y, static_cast<std::int16_t>(Screen_Size_Y - 1U)) };
+
+    for (std::int16_t y0 = v0.y; y0 <= v1.y; ) {
+      const band_type    by = band_y_[y0];
+      const std::int16_t y1 = util::min2(static_cast<std::int16_t>(edge_y_[by + 1U] - 1), v1.y);
+      for (std::int16_t x0 = v0.x; x0 <= v1.x; ) {
+        const band_type    bx = band_x_[x0];
+        const std::int16_t x1 = util::min2(static_cast<std::int16_t>(edge_x_[bx + 1U] - 1), v1.x);
+        const std::size_t  i  = route_[by][bx];
+        if (i < HEAD_COUNT) {
+          primitive(*head_[i].head, route_local(i, { x0, y0 }), route_local(i, { x1, y1 }));
+          head_[i].dirty = true;
+        }
+        x0 = static_cast<std::int16_t>(x1 + 1);
+      }
+      y0 = static_cast<std::int16_t>(y1 + 1);
+    }
+  }
+
+
+  // advance the span color, a single color stays, a color array moves on
+  static inline color::value_type route_advance(color::value_type color, std::uint16_t)
+  { return color; }
+
+  static inline const color::value_type* route_advance(const color::value_type* colors, std::uint16_t n)
+  { return colors + n; }
+
+
+  /**
+   * Split a span at the band edges and pass the pieces to the covering heads
+   * \param Horz True for a horizontal, false for a vertical span
+   * \param T Span color, a single color or a color array
+   * \param start Start vertex of the span
+   * \param length Span length in pixel
+   * \param color Color or colors of the span
+   */
+  template<bool Horz, typename T>
+  void route_span(vertex_type start, std::uint16_t length, T color)
+  {
+    if (clipping_.is_enabled()) {
+      // clipping is done per pixel
+      if (Horz) {
+        gpr::span_horz(start, length, color);
+      }
+      else {
+        gpr::span_vert(start, length, color);
+      }
+      return;
+    }
+
+    // clip the span to the screen
+    std::int16_t&      pos  = Horz ? start.x : start.y;
+    const std::int16_t line = Horz ? start.y : start.x;
+    const std::int16_t size = static_cast<std::int16_t>(Horz ? Screen_Size_X : Screen_Size_Y);
+    if ((line < 0) || (line >= static_cast<std::int16_t>(Horz ? Screen_Size_Y : Screen_Size_X)) || (pos >= size) || (pos + length <= 0)) {
+      return;
+    }
+    if (pos < 0) {
+      color  = route_advance(color, static_cast<std::uint16_t>(-pos));
+      length = static_cast<std::uint16_t>(length + pos);
+      pos    = 0;
+    }
+    if (pos + length > size) {
+      length = static_cast<std::uint16_t>(size - pos);
+    }
+
+    // walk along the bands
+    const band_type*    band  = Horz ? band_x_ : band_y_;
+    const std::int16_t* edge  = Horz ? edge_x_ : edge_y_;
+    const band_type     cross = Horz ? band_y_[line] : band_x_[line];
+    while (length) {
+      const band_type     b = band[pos];
+      const std::uint16_t n = static_cast<std::uint16_t>(util::min2(static_cast<std::int16_t>(length), static_cast<std::int16_t>(edge[b + 1U] - pos)));
+      const std::size_t   i = Horz ? route_[cross][b] : route_[b][cross];
+      if (i < HEAD_COUNT) {
+        if (Horz) {
+          head_[i].head->span_horz(route_local(i, start), n, color);
+        }
+        else {
+          head_[i].head->span_vert(route_local(i, start), n, color);
+        }
+        head_[i].dirty = true;
+      }
+      color  = route_advance(color, n);
+      length = static_cast<std::uint16_t>(length - n);
+      pos    = static_cast<std::int16_t>(pos + n);
+    }
+  }
+
 };
 
 } // namespace head
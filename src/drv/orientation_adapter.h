@@ -0,0 +1,347 @@
+///////////////////////////////////////////////////////////////////////////////
+// \author (c) Marco Paland (info@paland.com)
+//             2017-2017, PALANDesign Hannover, Germany
+//
+// \license The MIT License (MIT)
+//
+// This file is part of the vic library.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// \brief Orientation adapter, adds software orientation support to any graphic head
+// The adapter provides the logical (rotated/mirrored) screen and maps all
+// pixels, spans and blits to the physical coordinates of the bound head.
+// Rotated spans are passed as spans of the other axis (column runs) to the head,
+// rotated blits use a blocked transpose so that the head gets row spans.
+//
+// Usage:
+// vic::head::ILI9325<240U, 320U> _panel(device_handle, nullptr, nullptr, false);   // physical head
+// vic::head::orientation_adapter _head(_panel, vic::drv::orientation_90);          // 320 x 240 logical screen
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _VIC_DRV_ORIENTATION_ADAPTER_H_
+#define _VIC_DRV_ORIENTATION_ADAPTER_H_
+
+#include "../drv.h"
+
+
+// defines the driver name and version
+#define VIC_DRV_ORIENTATION_ADAPTER_VERSION   "Orientation adapter 1.00"
+
+namespace vic {
+namespace head {
+
+
+/**
+ * Orientation adapter
+ * The bound head must be used in its physical orientation (orientation_0)
+ */
+class orientation_adapter : public drv
+{
+public:
+
+  /////////////////////////////////////////////////////////////////////////////
+  // M A N D A T O R Y   D R I V E R   F U N C T I O N S
+
+  /**
+   * ctor
+   * \param head The bound (physical) head
+   * \param orientation Orientation of the logical screen
+   */
+  orientation_adapter(drv& head, orientation_type orientation)
+    : drv((static_cast<std::uint8_t>(orientation) & 0x01U) ? head.screen_height() : head.screen_width(),
+          (static_cast<std::uint8_t>(orientation) & 0x01U) ? head.screen_width()  : head.screen_height(),
+          (static_cast<std::uint8_t>(orientation) & 0x01U) ? head.screen_height() : head.screen_width(),
+          (static_cast<std::uint8_t>(orientation) & 0x01U) ? head.screen_width()  : head.screen_height(),
+          0, 0,
+          orientation)
+    , head_(head)
+  { }
+
+
+protected:
+
+  virtual void drv_init() final
+  {
+    head_.init();
+  }
+
+
+  virtual void drv_shutdown() final
+  {
+    head_.shutdown();
+  }
+
+
+  virtual inline const char* drv_version() const final
+  {
+    return (const char*)VIC_DRV_ORIENTATION_ADAPTER_VERSION;
+  }
+
+
+  virtual inline bool drv_is_graphic() const final
+  {
+    // the adapter is only usable for graphic heads
+    return true;
+  }
+
+
+  virtual void drv_cls() final
+  {
+    head_.cls();
+  }
+
+
+  virtual inline void drv_pixel_set_color(vertex_type point, color::value_type color) final
+  {
+    // check limits and clipping
+    if (!screen_is_inside(point) || (!clipping_.is_inside(point))) {
+      // out of bounds or outside clipping region
+      return;
+    }
+    head_.pixel_set(orientation_to_physical(point), color);
+  }
+
+
+  virtual inline color::value_type drv_pixel_get(vertex_type point) final
+  {
+    // check limits
+    if (!screen_is_inside(point)) {
+      // out of bounds
+      return color::black;
+    }
+    return head_.pixel_get(orientation_to_physical(point));
+  }
+
+
+  virtual inline text_subpixel_type drv_subpixel_order() const final
+  {
+    // the screen order of the bound head is mapped by the orientation of the adapter
+    return head_.text_subpixel_order();
+  }
+
+
+  virtual void drv_present() final
+  {
+    head_.present();
+  }
+
+
+public:
+
+  ///////////////////////////////////////////////////////////////////////////////
+  // overwritten gpr functions for span and blit mapping
+  //
+
+  virtual void span_horz(vertex_type start, std::uint16_t length, color::value_type color) final
+  {
+    span(start, length, false, color);
+  }
+
+
+  virtual void span_horz(vertex_type start, std::uint16_t length, const color::value_type* colors) final
+  {
+    span(start, length, false, colors);
+  }
+
+
+  virtual void span_vert(vertex_type start, std::uint16_t length, color::value_type color) final
+  {
+    span(start, length, true, color);
+  }
+
+
+  virtual void span_vert(vertex_type start, std::uint16_t length, const color::value_type* colors) final
+  {
+    span(start, length, true, colors);
+  }
+
+
+  /**
+   * Bit block image transfer to the display area
+   * If the orientation swaps the axis, the image is transposed in blocks of 8 columns, so that each
+   * logical image column is passed as physical row span to the head.
+   * The transpose buffer takes 8 * VIC_GPR_SPAN_BUFFER_SIZE ARGB pixels on the cpu stack.
+   * \param top_left Top/left vertex of the image
+   * \param bottom_right Bottom/right vertex of the image, included
+   * \param color_format Color format of the image data
+   * \param data Image data
+   */
+  virtual void blitter(vertex_type top_left, vertex_type bottom_right, color::format_type color_format, const void* data) final
+  {
+    if (!orientation_is_swapped() || clipping_.is_enabled()) {
+      // rows stay rows, the generic blitter renders them as (mapped) spans
+      gpr::blitter(top_left, bottom_right, color_format, data);
+      return;
+    }
+    vertex_top_left(top_left, bottom_right);
+    transpose_visitor visitor = { *this, top_left, bottom_right, static_cast<const std::uint8_t*>(data) };
+    color::format_dispatch(color_format, visitor);
+    present();
+  }
+
+
+  virtual void display_enable(bool enable = true) final
+  {
+    head_.display_enable(enable);
+  }
+
+
+  virtual void brightness_set(std::uint8_t level) final
+  {
+    head_.brightness_set(level);
+  }
+
+
+private:
+
+  // format visitor of the transposing blitter
+  struct transpose_visitor
+  {
+    orientation_adapter& a;
+    vertex_type          top_left;
+    vertex_type          bottom_right;
+    const std::uint8_t*  data;
+
+    template<color::format_type Format>
+    inline void apply() { a.blit_transposed<Format>(top_left, bottom_right, data); }
+  };
+
+
+  /**
+   * Blocked transpose blit kernel
+   * The image is read in blocks of 8 columns x VIC_GPR_SPAN_BUFFER_SIZE rows, transposed into
+   * the band buffer and every logical column is rendered as one span
+   */
+  template<color::format_type Format>
+  void blit_transposed(vertex_type top_left, vertex_type bottom_right, const std::uint8_t* data)
+  {
+    const std::uint16_t width  = static_cast<std::uint16_t>(bottom_right.x - top_left.x + 1);
+    const std::uint16_t height = static_cast<std::uint16_t>(bottom_right.y - top_left.y + 1);
+    const std::size_t   stride = color::pixel_kernel<Format>::stride(width);
+
+    color::value_type band[8U][VIC_GPR_SPAN_BUFFER_SIZE];
+    color::value_type row[8U];
+    for (std::uint16_t x0 = 0U; x0 < width; x0 = static_cast<std::uint16_t>(x0 + 8U)) {
+      const std::uint16_t bw = (static_cast<std::uint16_t>(width - x0) < 8U) ? static_cast<std::uint16_t>(width - x0) : static_cast<std::uint16_t>(8U);
+      for (std::uint16_t y0 = 0U; y0 < height; y0 = static_cast<std::uint16_t>(y0 + VIC_GPR_SPAN_BUFFER_SIZE)) {
+        const std::uint16_t bh = (static_cast<std::uint16_t>(height - y0) < VIC_GPR_SPAN_BUFFER_SIZE) ? static_cast<std::uint16_t>(height - y0) : static_cast<std::uint16_t>(VIC_GPR_SPAN_BUFFER_SIZE);
+        // transpose the block
+        const std::uint8_t* src = data + y0 * stride;
+        for (std::uint16_t y = 0U; y < bh; ++y, src += stride) {
+          color::span_to_argb<Format>(row, src, x0, bw);
+          gamma_alpha(row, bw);
+          for (std::uint16_t x = 0U; x < bw; ++x) {
+            band[x][y] = row[x];
+          }
+        }
+        // a logical column is a physical row
+        for (std::uint16_t x = 0U; x < bw; ++x) {
+          span({ static_cast<std::int16_t>(top_left.x + x0 + x), static_cast<std::int16_t>(top_left.y + y0) }, bh, true, band[x]);
+        }
+      }
+    }
+  }
+
+
+  /**
+   * Map a logical span to the physical span of the head
+   * \param start Logical start vertex
+   * \param length Span length
+   * \param step Physical step of the logical span direction
+   * \return Physical start vertex (top or left end of the span)
+   */
+  inline vertex_type span_map(vertex_type start, std::uint16_t length, vertex_type step) const
+  {
+    vertex_type phys = orientation_to_physical(start);
+    if (step.x < 0) {
+      phys.x = static_cast<std::int16_t>(phys.x - (length - 1));
+    }
+    if (step.y < 0) {
+      phys.y = static_cast<std::int16_t>(phys.y - (length - 1));
+    }
+    return phys;
+  }
+
+
+  // render a logical span in the given color
+  inline void span(vertex_type start, std::uint16_t length, bool vertical, color::value_type color)
+  {
+    if (!length) {
+      return;
+    }
+    if (clipping_.is_enabled()) {
+      // pixel wise in case of active clipping
+      vertical ? gpr::span_vert(start, length, color) : gpr::span_horz(start, length, color);
+      return;
+    }
+    const vertex_type step = vertical ? orientation_step_y() : orientation_step_x();
+    const vertex_type phys = span_map(start, length, step);
+    if (step.x) {
+      head_.span_horz(phys, length, color);
+    }
+    else {
+      head_.span_vert(phys, length, color);
+    }
+  }
+
+
+  // render a logical span out of a color array, spans running in negative physical direction are reversed
+  inline void span(vertex_type start, std::uint16_t length, bool vertical, const color::value_type* colors)
+  {
+    if (!length) {
+      return;
+    }
+    if (clipping_.is_enabled()) {
+      // pixel wise in case of active clipping
+      vertical ? gpr::span_vert(start, length, colors) : gpr::span_horz(start, length, colors);
+      return;
+    }
+    const vertex_type step = vertical ? orientation_step_y() : orientation_step_x();
+    const vertex_type phys = span_map(start, length, step);
+    if (step.x > 0 || step.y > 0) {
+      step.x ? head_.span_horz(phys, length, colors) : head_.span_vert(phys, length, colors);
+      return;
+    }
+    // reverse the colors in chunks, the physical start is the logical end
+    color::value_type buffer[VIC_GPR_SPAN_BUFFER_SIZE];
+    for (std::uint16_t n = 0U; n < length; ) {
+      const std::uint16_t len = (static_cast<std::uint16_t>(length - n) < VIC_GPR_SPAN_BUFFER_SIZE) ? static_cast<std::uint16_t>(length - n) : static_cast<std::uint16_t>(VIC_GPR_SPAN_BUFFER_SIZE);
+      for (std::uint16_t i = 0U; i < len; ++i) {
+        buffer[i] = colors[length - 1U - n - i];
+      }
+      if (step.x) {
+        head_.span_horz({ static_cast<std::int16_t>(phys.x + n), phys.y }, len, buffer);
+      }
+      else {
+        head_.span_vert({ phys.x, static_cast<std::int16_t>(phys.y + n) }, len, buffer);
+      }
+      n = static_cast<std::uint16_t>(n + len);
+    }
+  }
+
+
+private:
+  drv&  head_;    // bound physical head
+};
+
+} // namespace head
+} // namespace vic
+
+#endif  // _VIC_DRV_ORIENTATION_ADAPTER_H_
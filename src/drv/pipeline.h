@@ -0,0 +1,580 @@
+///////////////////////////////////////////////////////////////////////////////
+// \author (c) Marco Paland (info@paland.com)
+//             2014-2017, PALANDesign Hannover, Germany
+//
+// \license The MIT License (MIT)
+//
+// This file is part of the vic library.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// \brief Pipeline driver, asynchronous double buffered present of a head.
+// Rendering is done into the back plane of the pipeline. On present the changed row spans
+// are copied to the front plane, which is transferred to the bound head by a flusher while
+// the rendering of the next frame goes on in the back plane. So CPU and bus time overlap.
+// The flusher is
+// - a POSIX thread of the pipeline, if VIC_DRV_PIPELINE_THREAD is set in vic_cfg.h
+// - the application, if the pipeline is created with 'external_flush'. flush() is called
+//   in the flushing context, like a low priority task or a DMA completion callback
+// - the present call itself otherwise (no overlap)
+// The backpressure defines what present does if the flusher is still busy with the previous
+// frame: wait for it (block) or return at once (skip), the changes are taken by the next
+// present then. fence() waits until all presented changes are on the head.
+// The head is presented by the flusher only and must have the size of the pipeline, a head
+// with a different orientation is bound by an orientation_adapter.
+// Transparent colors are blended in the back plane, so the head gets opaque colors only.
+// The pipeline takes two ARGB planes, 8 bytes per pixel.
+//
+// Usage:
+// vic::head::ILI9325<240U, 320U> _panel(device_handle, nullptr, nullptr, false);
+// vic::head::pipeline<240U, 320U> _head(_panel, vic::head::pipeline<240U, 320U>::backpressure_skip);
+// _head.init();
+// _head.present_lock();      // render the frame
+// ...
+// _head.present_lock(false); // pass the frame to the flusher and go on with the next one
+// _head.fence();             // wait until the frame is on the panel
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _VIC_DRV_PIPELINE_H_
+#define _VIC_DRV_PIPELINE_H_
+
+#include "../drv.h"
+#include <atomic>
+#include <cstring>
+
+#if (VIC_DRV_PIPELINE_THREAD > 0)
+#include <pthread.h>
+#endif
+
+
+// defines the driver name and version
+#define VIC_DRV_PIPELINE_VERSION   "Pipeline driver 1.00"
+
+
+namespace vic {
+namespace head {
+
+
+/**
+ * Pipeline driver class
+ * \param Screen_Size_X Screen width, the head must have this width
+ * \param Screen_Size_Y Screen height, the head must have this height
+ */
+template<std::uint16_t Screen_Size_X, std::uint16_t Screen_Size_Y>
+class pipeline : public drv
+{
+public:
+
+  /**
+   * Behavior of present if the flusher is busy
+   */
+  typedef enum tag_backpressure_type
+  {
+    backpressure_block = 0,   // present waits until the flusher has transferred the previous frame
+    backpressure_skip         // present returns at once, the changes are passed by the next present
+  } backpressure_type;
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // M A N D A T O R Y   F U N C T I O N S
+
+  /**
+   * ctor
+   * \param head The bound head, presented by the flusher only
+   * \param backpressure Behavior of present if the flusher is busy
+   * \param external_flush True if the application transfers the frames by calling flush()
+   */
+  pipeline(drv& head, backpressure_type backpressure = backpressure_block, bool external_flush = false)
+    : drv(Screen_Size_X, Screen_Size_Y,
+          Screen_Size_X, Screen_Size_Y)
+    , head_(&head)
+    , backpressure_(backpressure)
+    , external_flush_(external_flush)
+    , skipped_(false)
+    , pending_(false)
+  {
+    head_->present_lock();    // spans must not present the head
+
+    // the back plane starts like a cleared display
+    for (std::uint16_t y = 0U; y < Screen_Size_Y; ++y) {
+      for (std::uint16_t x = 0U; x < Screen_Size_X; ++x) {
+        back_[y][x] = color::black;
+      }
+      back_dirty_[y]  = span_clean();
+      front_dirty_[y] = span_clean();
+    }
+
+#if (VIC_DRV_PIPELINE_THREAD > 0)
+    stop_           = false;
+    thread_running_ = false;
+    pthread_mutex_init(&mutex_, nullptr);
+    pthread_cond_init(&cond_, nullptr);
+    if (!external_flush_) {
+      // if the thread can't be created, present transfers the frames itself
+      thread_running_ = !pthread_create(&thread_, nullptr, &pipeline::flusher, this);
+    }
+#endif
+  }
+
+
+  /**
+   * dtor
+   * Shutdown the driver, the flusher is stopped and the head is unlocked again
+   */
+  ~pipeline()
+  {
+    // unlock the head while the flusher is idle, so it can be used on its own
+    fence();
+    head_->present_lock(false);
+    drv_shutdown();
+
+#if (VIC_DRV_PIPELINE_THREAD > 0)
+    if (thread_running_) {
+      pthread_mutex_lock(&mutex_);
+      stop_ = true;
+      pthread_cond_broadcast(&cond_);
+      pthread_mutex_unlock(&mutex_);
+      pthread_join(thread_, nullptr);
+    }
+    pthread_cond_destroy(&cond_);
+    pthread_mutex_destroy(&mutex_);
+#endif
+  }
+
+
+protected:
+
+  // driver init
+  inline virtual void drv_init()
+  {
+    fence();
+    head_->drv_init();
+  }
+
+
+  // driver shutdown
+  inline virtual void drv_shutdown()
+  {
+    fence();
+    head_->drv_shutdown();
+  }
+
+
+  // get driver name and version
+  inline virtual const char* drv_version() const final
+  {
+    return (const char*)VIC_DRV_PIPELINE_VERSION;
+  }
+
+
+  inline virtual bool drv_is_graphic() const final
+  {
+    return true;
+  }
+
+
+  // clear the back plane with the background color, the head is cleared by the next present
+  inline virtual void drv_cls()
+  {
+    const color::value_type color = bg_get_color();
+    for (std::uint16_t y = 0U; y < Screen_Size_Y; ++y) {
+      for (std::uint16_t x = 0U; x < Screen_Size_X; ++x) {
+        back_[y][x] = color;
+      }
+      back_dirty_[y].x0 = 0;
+      back_dirty_[y].x1 = static_cast<std::int16_t>(Screen_Size_X - 1U);
+    }
+  }
+
+
+  /**
+   * Pass the changes of the back plane to the flusher
+   * With backpressure_block this waits until the flusher has transferred the previous frame,
+   * with backpressure_skip this returns at once if the flusher is busy
+   */
+  inline virtual void drv_present()
+  {
+    if (!front_acquire(backpressure_ == backpressure_block)) {
+      // flusher is busy, the changes are passed by the next present (or fence)
+      skipped_ = true;
+      return;
+    }
+    front_submit();
+  }
+
+
+  /**
+   * Set pixel in given color in the back plane, a transparent color is blended over the pixel,
+   * so the head gets opaque colors only
+   * \param point Pixel coordinates
+   * \param color Color of pixel in ARGB format
+   */
+  inline virtual void drv_pixel_set_color(vertex_type point, color::value_type color)
+  {
+    // check limits and clipping
+    if (!screen_is_inside(point) || (!clipping_.is_inside(point))) {
+      // out of bounds or outside clipping region
+      return;
+    }
+    back_[point.y][point.x] = color::alpha_blend(color, back_[point.y][point.x]);
+    dirty_mark(point.y, point.x, point.x);
+  }
+
+
+  /**
+   * Return the color of the pixel out of the back plane
+   * \param point Coordinates of the pixel
+   * \return Color of pixel in ARGB format
+   */
+  inline virtual color::value_type drv_pixel_get(vertex_type point)
+  {
+    return screen_is_inside(point) ? back_[point.y][point.x] : color::black;
+  }
+
+
+public:
+
+  /**
+   * Wait until all presented changes are transferred to the head
+   * A present which was skipped by backpressure is passed to the flusher before.
+   * With external flushing the flushing context must be able to run while this is waiting.
+   */
+  void fence()
+  {
+    if (skipped_) {
+      front_acquire(true);
+      front_submit();
+    }
+    front_acquire(true);
+  }
+
+
+  /**
+   * Transfer the presented frame to the head, used with external flushing only
+   * Call this in the flushing context, like a low priority task or a DMA completion callback
+   * \return true if a frame was transferred, false if there was no frame
+   */
+  bool flush()
+  {
+    if (!external_flush_ || !pending_.load(std::memory_order_acquire)) {
+      return false;
+    }
+    flush_front();
+    pending_.store(false, std::memory_order_release);
+    return true;
+  }
+
+
+  /**
+   * Set display brightness or backlight of the head, this waits for the flusher
+   * \param level Brightness level
+   */
+  virtual void brightness_set(std::uint8_t level)
+  {
+    fence();
+    head_->brightness_set(level);
+  }
+
+
+  /**
+   * Enable or disable the head, this waits for the flusher
+   * \param enable True to enable the display
+   */
+  virtual void display_enable(bool enable = true)
+  {
+    fence();
+    head_->display_enable(enable);
+  }
+
+
+  /**
+   * The back plane can be read back, so the subpixel order of the head is used
+   */
+  virtual text_subpixel_type text_subpixel_order() const
+  {
+    return head_->text_subpixel_order();
+  }
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // S P A N S
+
+  /**
+   * Set a horizontal span of pixels in the given color in the back plane
+   * \param start Left vertex of the span
+   * \param length Span length in pixel
+   * \param color Color of the span
+   */
+  virtual void span_horz(vertex_type start, std::uint16_t length, color::value_type color)
+  {
+    if (clipping_.is_enabled()) {
+      gpr::span_horz(start, length, color);
+      return;
+    }
+    std::int16_t x0, x1;
+    if (span_clip(start.x, length, Screen_Size_X, x0, x1) && span_is_inside(start.y, Screen_Size_Y)) {
+      color::value_type* row = back_[start.y];
+      if (color::is_opaque(color)) {
+        for (std::int16_t x = x0; x <= x1; ++x) {
+          row[x] = color;
+        }
+      }
+      else {
+        for (std::int16_t x = x0; x <= x1; ++x) {
+          row[x] = color::alpha_blend(color, row[x]);
+        }
+      }
+      dirty_mark(start.y, x0, x1);
+    }
+  }
+
+
+  /**
+   * Set a horizontal span of pixels out of a color array in the back plane
+   * \param start Left vertex of the span
+   * \param length Span length in pixel
+   * \param colors Array of 'length' colors in ARGB format
+   */
+  virtual void span_horz(vertex_type start, std::uint16_t length, const color::value_type* colors)
+  {
+    if (clipping_.is_enabled()) {
+      gpr::span_horz(start, length, colors);
+      return;
+    }
+    std::int16_t x0, x1;
+    if (span_clip(start.x, length, Screen_Size_X, x0, x1) && span_is_inside(start.y, Screen_Size_Y)) {
+      color::value_type* row = back_[start.y];
+      colors += x0 - start.x;
+      for (std::int16_t x = x0; x <= x1; ++x, ++colors) {
+        row[x] = color::alpha_blend(*colors, row[x]);
+      }
+      dirty_mark(start.y, x0, x1);
+    }
+  }
+
+
+  /**
+   * Set a vertical span of pixels in the given color in the back plane
+   * \param start Top vertex of the span
+   * \param length Span length in pixel
+   * \param color Color of the span
+   */
+  virtual void span_vert(vertex_type start, std::uint16_t length, color::value_type color)
+  {
+    if (clipping_.is_enabled()) {
+      gpr::span_vert(start, length, color);
+      return;
+    }
+    std::int16_t y0, y1;
+    if (span_clip(start.y, length, Screen_Size_Y, y0, y1) && span_is_inside(start.x, Screen_Size_X)) {
+      for (std::int16_t y = y0; y <= y1; ++y) {
+        back_[y][start.x] = color::alpha_blend(color, back_[y][start.x]);
+        dirty_mark(y, start.x, start.x);
+      }
+    }
+  }
+
+
+  /**
+   * Set a vertical span of pixels out of a color array in the back plane
+   * \param start Top vertex of the span
+   * \param length Span length in pixel
+   * \param colors Array of 'length' colors in ARGB format
+   */
+  virtual void span_vert(vertex_type start, std::uint16_t length, const color::value_type* colors)
+  {
+    if (clipping_.is_enabled()) {
+      gpr::span_vert(start, length, colors);
+      return;
+    }
+    std::int16_t y0, y1;
+    if (span_clip(start.y, length, Screen_Size_Y, y0, y1) && span_is_inside(start.x, Screen_Size_X)) {
+      colors += y0 - start.y;
+      for (std::int16_t y = y0; y <= y1; ++y) {
+        back_[y][start.x] = color::alpha_blend(*colors++, back_[y][start.x]);
+        dirty_mark(y, start.x, start.x);
+      }
+    }
+  }
+
+
+private:
+
+  // changed span of a row, x0 > x1 is unchanged
+  typedef struct tag_span_type {
+    std::int16_t x0;
+    std::int16_t x1;
+  } span_type;
+
+
+  static inline span_type span_clean()
+  {
+    return { static_cast<std::int16_t>(Screen_Size_X), -1 };
+  }
+
+
+  // clip the span [pos, pos + length) to [0, size), returns false if nothing is left
+  static inline bool span_clip(std::int16_t pos, std::uint16_t length, std::uint16_t size, std::int16_t& p0, std::int16_t& p1)
+  {
+    const std::int32_t end = static_cast<std::int32_t>(pos) + static_cast<std::int32_t>(length) - 1;
+    p0 = pos < 0 ? 0 : pos;
+    p1 = static_cast<std::int16_t>(end >= static_cast<std::int32_t>(size) ? size - 1U : (end < 0 ? -1 : end));
+    return p0 <= p1;
+  }
+
+
+  static inline bool span_is_inside(std::int16_t pos, std::uint16_t size)
+  {
+    return (pos >= 0) && (pos < static_cast<std::int16_t>(size));
+  }
+
+
+  // add [x0, x1] to the changed span of row y
+  inline void dirty_mark(std::int16_t y, std::int16_t x0, std::int16_t x1)
+  {
+    span_type& span = back_dirty_[y];
+    if (x0 < span.x0) span.x0 = x0;
+    if (x1 > span.x1) span.x1 = x1;
+  }
+
+
+  /**
+   * Wait until the front plane is free
+   * \param wait True to wait for the flusher, false to return at once
+   * \return true if the front plane is free
+   */
+  bool front_acquire(bool wait)
+  {
+#if (VIC_DRV_PIPELINE_THREAD > 0)
+    if (thread_running_) {
+      pthread_mutex_lock(&mutex_);
+      while (wait && pending_.load(std::memory_order_relaxed)) {
+        pthread_cond_wait(&cond_, &mutex_);
+      }
+      const bool is_free = !pending_.load(std::memory_order_relaxed);
+      pthread_mutex_unlock(&mutex_);
+      return is_free;
+    }
+#endif
+    // external (or no) flusher
+    while (wait && pending_.load(std::memory_order_acquire)) { }
+    return !pending_.load(std::memory_order_acquire);
+  }
+
+
+  // copy the changes of the back plane to the free front plane and pass them to the flusher
+  void front_submit()
+  {
+    skipped_ = false;
+
+    bool changed = false;
+    for (std::uint16_t y = 0U; y < Screen_Size_Y; ++y) {
+      const span_type span = back_dirty_[y];
+      if (span.x0 <= span.x1) {
+        std::memcpy(&front_[y][span.x0], &back_[y][span.x0], static_cast<std::size_t>(span.x1 - span.x0 + 1) * sizeof(color::value_type));
+        front_dirty_[y] = span;
+        back_dirty_[y]  = span_clean();
+        changed = true;
+      }
+    }
+    if (!changed) {
+      return;
+    }
+
+#if (VIC_DRV_PIPELINE_THREAD > 0)
+    if (thread_running_) {
+      pthread_mutex_lock(&mutex_);
+      pending_.store(true, std::memory_order_relaxed);
+      pthread_cond_broadcast(&cond_);
+      pthread_mutex_unlock(&mutex_);
+      return;
+    }
+#endif
+    if (external_flush_) {
+      pending_.store(true, std::memory_order_release);
+      return;
+    }
+
+    // no flusher, transfer now
+    flush_front();
+  }
+
+
+  // transfer the changed spans of the front plane to the head and present it
+  void flush_front()
+  {
+    for (std::uint16_t y = 0U; y < Screen_Size_Y; ++y) {
+      const span_type span = front_dirty_[y];
+      if (span.x0 <= span.x1) {
+        head_->span_horz({ span.x0, static_cast<std::int16_t>(y) }, static_cast<std::uint16_t>(span.x1 - span.x0 + 1), &front_[y][span.x0]);
+        front_dirty_[y] = span_clean();
+      }
+    }
+    head_->drv_present();
+  }
+
+
+#if (VIC_DRV_PIPELINE_THREAD > 0)
+  // flusher thread
+  static void* flusher(void* arg)
+  {
+    pipeline& p = *static_cast<pipeline*>(arg);
+    pthread_mutex_lock(&p.mutex_);
+    for (;;) {
+      while (!p.stop_ && !p.pending_.load(std::memory_order_relaxed)) {
+        pthread_cond_wait(&p.cond_, &p.mutex_);
+      }
+      if (p.stop_) {
+        break;
+      }
+      pthread_mutex_unlock(&p.mutex_);
+      p.flush_front();
+      pthread_mutex_lock(&p.mutex_);
+      p.pending_.store(false, std::memory_order_relaxed);
+      pthread_cond_broadcast(&p.cond_);
+    }
+    pthread_mutex_unlock(&p.mutex_);
+    return nullptr;
+  }
+#endif
+
+
+  color::value_type   back_[Screen_Size_Y][Screen_Size_X];    // rendering plane
+  color::value_type   front_[Screen_Size_Y][Screen_Size_X];   // plane in transfer, valid in the changed spans only
+  span_type           back_dirty_[Screen_Size_Y];             // changed spans of the back plane
+  span_type           front_dirty_[Screen_Size_Y];            // spans of the front plane to transfer
+  drv*                head_;                                  // bound head
+  backpressure_type   backpressure_;                          // behavior of present if the flusher is busy
+  bool                external_flush_;                        // true if the application calls flush()
+  bool                skipped_;                               // true if a present was skipped by backpressure
+  std::atomic<bool>   pending_;                               // true if the front plane is passed to the flusher
+
+#if (VIC_DRV_PIPELINE_THREAD > 0)
+  bool                stop_;                                  // flusher shutdown
+  bool                thread_running_;                        // true if the flusher thread is running
+  pthread_mutex_t     mutex_;                                 // protects pending_ and stop_
+  pthread_cond_t      cond_;                                  // signals pending_ and stop_ changes
+  pthread_t           thread_;                                // flusher thread
+#endif
+};
+
+} // namespace head
+} // namespace vic
+
+#endif  // _VIC_DRV_PIPELINE_H_
@@ -149,10 +149,10 @@ protected:
  
   /**
    * Output a single ASCII/UNICODE char at the actual cursor position
-   * \param ch Output character in 16 bit ASCII/UNICODE (NOT UTF-8) format, 00-7F is compatible with ASCII
+   * \param ch Output character in 21 bit ASCII/UNICODE (NOT UTF-8) format, 00-7F is compatible with ASCII
    * \return 1 if the char is rendered, 0 if error/not rendered
    */
-  virtual std::uint16_t text_char(std::uint16_t ch)
+  virtual std::uint16_t text_char(std::uint32_t ch)
   {
     if (ch < 0x20U) {
       // ignore non characters
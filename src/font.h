@@ -32,6 +32,8 @@
 
 #include <cstdint>
 
+#include "vic_cfg.h"
+
 
 namespace vic {
 namespace font {
@@ -55,6 +57,17 @@ typedef struct tag_charinfo_ext_type {
   const std::uint8_t* data;       // char data
 } charinfo_ext_type;
 
+// compressed character info (RLE font)
+typedef struct tag_charinfo_rle_type {
+  std::uint8_t  xsize;            // x-size of the (tight) glyph box in pixel
+  std::uint8_t  ysize;            // y-size of the (tight) glyph box in pixel
+  std::int8_t   xpos;             // x-start position
+  std::int8_t   ypos;             // y-start position
+  std::uint8_t  xdist;            // x-distance (cursor movement)
+  std::uint8_t  reserved;         // reserved, 0
+  std::uint16_t offset;           // offset of the glyph RLE stream in the range data
+} charinfo_rle_type;
+
 // standard mono font (ASCII/ANSI support)
 typedef struct tag_mono_type {
   std::uint8_t first;             // first char code
@@ -72,14 +85,23 @@ typedef struct tag_prop_type {
   const struct tag_prop_type* next;
 } prop_type;
 
-// extended prop font (UNICODE support)
+// extended prop font (UNICODE support, 21 bit code points)
 typedef struct tag_prop_ext_type {
-  std::uint16_t first;
-  std::uint16_t last;
+  std::uint32_t first;
+  std::uint32_t last;
   const charinfo_ext_type*        char_info_ext;
   const struct tag_prop_ext_type* next;
 } prop_ext_type;
 
+// compressed prop font (UNICODE support, 21 bit code points)
+typedef struct tag_prop_rle_type {
+  std::uint32_t first;
+  std::uint32_t last;
+  const charinfo_rle_type*        char_info_rle;
+  const std::uint8_t*             data;   // RLE streams of all glyphs of the range
+  const struct tag_prop_rle_type* next;
+} prop_rle_type;
+
 // font info
 typedef struct tag_font_type {
   std::uint8_t attr;              // font attributes
@@ -90,10 +112,12 @@ typedef struct tag_font_type {
     const mono_type*     mono;
     const prop_type*     prop;
     const prop_ext_type* prop_ext;
+    const prop_rle_type* prop_rle;
     tag_font_type_type()                       : prop(nullptr) { }
     tag_font_type_type(const mono_type* p)     : mono(p) { }
     tag_font_type_type(const prop_type* p)     : prop(p) { }
     tag_font_type_type(const prop_ext_type* p) : prop_ext(p) { }
+    tag_font_type_type(const prop_rle_type* p) : prop_rle(p) { }
   } font_type_type;
 } font_type;
 
@@ -113,6 +137,438 @@ const std::uint8_t TYPE_MASK        =  0x20U;   // mask
 const std::uint8_t TYPE_MONO        =  0x00U;   // monospaced font
 const std::uint8_t TYPE_PROP        =  0x20U;   // proportional font
 
+const std::uint8_t FORMAT_MASK      =  0x40U;   // mask
+const std::uint8_t FORMAT_RAW       =  0x00U;   // glyphs are stored as packed pixel rows
+const std::uint8_t FORMAT_RLE       =  0x40U;   // glyphs are stored as RLE streams (prop_rle_type, implies TYPE_PROP)
+
+const std::uint8_t SUBPIXEL_MASK    =  0x80U;   // mask
+const std::uint8_t SUBPIXEL_NONE    =  0x00U;   // one coverage sample per pixel
+const std::uint8_t SUBPIXEL_3X      =  0x80U;   // three horizontal coverage samples per pixel (LCD stripe), glyph metrics are in pixel
+
+
+/**
+ * Returns the count of coverage samples per glyph pixel
+ * Glyphs of subpixel fonts are stored at 3x horizontal resolution, a glyph row holds 3 * xsize samples
+ * \param font Font
+ * \return 3 for subpixel fonts, otherwise 1
+ */
+inline std::uint8_t samples(const font_type& font)
+{
+  return ((font.attr & SUBPIXEL_MASK) == SUBPIXEL_3X) ? 3U : 1U;
+}
+
+
+/**
+ * RLE glyph stream
+ * The pixels of the tight glyph box are stored as runs of equal coverage, row by row, runs don't cross rows.
+ * 1, 2 and 4 bpp: one byte per run, the run length - 1 in the upper (8 - bpp) bits, the coverage in the lower bits
+ * 8 bpp:          two bytes per run, run length - 1 and coverage
+ * \param stream Stream position, advanced to the next run
+ * \param depth Bits per pixel
+ * \param length Run length in pixel
+ * \return Run coverage
+ */
+inline std::uint8_t rle_run(const std::uint8_t*& stream, std::uint8_t depth, std::uint16_t& length)
+{
+  if (depth >= 8U) {
+    length = static_cast<std::uint16_t>(stream[0] + 1U);
+    const std::uint8_t coverage = stream[1];
+    stream += 2U;
+    return coverage;
+  }
+  length = static_cast<std::uint16_t>((*stream >> depth) + 1U);
+  return static_cast<std::uint8_t>(*stream++ & ((1U << depth) - 1U));
+}
+
+
+/**
+ * Expand an RLE glyph into one coverage byte per pixel
+ * \param stream RLE stream of the glyph
+ * \param depth Bits per pixel
+ * \param pixels Pixel count of the glyph box (xsize * ysize), or of whole rows to expand a part of the glyph
+ * \param dst Destination, one byte per pixel
+ * \return Stream position behind the expanded pixels, runs end at the row end
+ */
+inline const std::uint8_t* rle_expand(const std::uint8_t* stream, std::uint8_t depth, std::uint16_t pixels, std::uint8_t* dst)
+{
+  std::uint16_t length;
+  while (pixels) {
+    const std::uint8_t coverage = rle_run(stream, depth, length);
+    length = length < pixels ? length : pixels;
+    pixels = static_cast<std::uint16_t>(pixels - length);
+    for (; length; --length) {
+      *dst++ = coverage;
+    }
+  }
+  return stream;
+}
+
+
+// unified glyph info, independent of the font type
+typedef struct tag_glyph_type {
+  std::uint8_t xsize;             // x-size to render in pixel
+  std::uint8_t ysize;             // y-size to render in pixel
+  std::int8_t  xpos;              // x-start position
+  std::int8_t  ypos;              // y-start position
+  std::uint8_t xdist;             // x-distance (cursor movement)
+  std::uint8_t bytes_per_line;    // bytes to store the glyph line, 0 for RLE glyphs
+  const std::uint8_t* data;       // glyph data (packed rows or RLE stream)
+  const font_type*    font;       // font of the glyph (format and depth of the data)
+} glyph_type;
+
+
+/**
+ * Glyph lookup index of a font
+ * The range list of a prop font is copied into a table which is sorted by char code, the
+ * chars 0x20 - 0x7F are additionally resolved by a direct table.
+ * Lookup is O(1) for ASCII chars and O(log n) for all other chars.
+ * Ranges which don't fit into the table (VIC_FONT_INDEX_RANGES) are searched linearly.
+ */
+class index
+{
+public:
+
+  index()
+    : font_(nullptr)
+    , range_count_(0U)
+    , overflow_(nullptr)
+  { }
+
+
+  /**
+   * Build the index of the given font
+   * \param font Font to index
+   */
+  void build(const font_type& font)
+  {
+    font_        = &font;
+    range_count_ = 0U;
+    overflow_    = nullptr;
+    for (std::uint_fast8_t i = 0U; i < DIRECT_SIZE; ++i) {
+      direct_[i] = 0U;
+    }
+
+    if ((font.attr & FORMAT_MASK) == FORMAT_RLE) {
+      const prop_rle_type* prop_rle = font.font_type_type.prop_rle;
+      for (; prop_rle && (range_count_ < VIC_FONT_INDEX_RANGES); prop_rle = prop_rle->next) {
+        range_insert(prop_rle->first, prop_rle->last, prop_rle);
+      }
+      overflow_ = prop_rle;
+    }
+    else if ((font.attr & ENCODING_MASK) == ENCODING_UNICODE) {
+      const prop_ext_type* prop_ext = font.font_type_type.prop_ext;
+      for (; prop_ext && (range_count_ < VIC_FONT_INDEX_RANGES); prop_ext = prop_ext->next) {
+        range_insert(prop_ext->first, prop_ext->last, prop_ext->char_info_ext);
+      }
+      overflow_ = prop_ext;
+    }
+    else if ((font.attr & TYPE_MASK) == TYPE_PROP) {
+      const prop_type* prop = font.font_type_type.prop;
+      for (; prop && (range_count_ < VIC_FONT_INDEX_RANGES); prop = prop->next) {
+        range_insert(prop->first, prop->last, prop->char_info);
+      }
+      overflow_ = prop;
+    }
+    else {
+      // mono font, no ranges
+      return;
+    }
+
+    // fill the direct table, the table is sorted so ASCII ranges are at the beginning
+    for (std::uint16_t r = 0U; (r < range_count_) && (r < 0xFFU); ++r) {
+      for (std::uint32_t ch = ranges_[r].first; (ch <= ranges_[r].last) && (ch < DIRECT_FIRST + DIRECT_SIZE); ++ch) {
+        if (ch >= DIRECT_FIRST) {
+          direct_[ch - DIRECT_FIRST] = static_cast<std::uint8_t>(r + 1U);
+        }
+      }
+    }
+  }
+
+
+  /**
+   * Returns the indexed font
+   * \return Font of the index, nullptr if no font is indexed
+   */
+  inline const font_type* font() const
+  {
+    return font_;
+  }
+
+
+  /**
+   * Find the glyph of the given char
+   * \param ch Char code in ASCII/UNICODE
+   * \param glyph Glyph info of the char
+   * \return true if the char exists in the font
+   */
+  bool find(std::uint32_t ch, glyph_type& glyph) const
+  {
+    if (!font_) {
+      return false;
+    }
+    glyph.font = font_;
+
+    if ((font_->attr & (FORMAT_MASK | ENCODING_MASK | TYPE_MASK)) == (FORMAT_RAW | ENCODING_ASCII | TYPE_MONO)) {
+      // mono font, direct access
+      const mono_type* mono = font_->font_type_type.mono;
+      if ((ch < mono->first) || (ch > mono->last)) {
+        return false;
+      }
+      glyph.xsize          = mono->xsize;
+      glyph.ysize          = font_->ysize;
+      glyph.xpos           = 0;
+      glyph.ypos           = 0;
+      glyph.xdist          = mono->xsize;
+      glyph.bytes_per_line = mono->bytes_per_line;
+      glyph.data           = &mono->data[(ch - mono->first) * font_->ysize * mono->bytes_per_line];
+      return true;
+    }
+
+    const range_type* range = nullptr;
+    if ((ch >= DIRECT_FIRST) && (ch < DIRECT_FIRST + DIRECT_SIZE)) {
+      // direct table
+      if (direct_[ch - DIRECT_FIRST]) {
+        range = &ranges_[direct_[ch - DIRECT_FIRST] - 1U];
+      }
+    }
+    else {
+      // binary search for the last range starting at or before ch
+      std::uint16_t lo = 0U, hi = range_count_;
+      while (lo < hi) {
+        const std::uint16_t mid = static_cast<std::uint16_t>((lo + hi) >> 1U);
+        if (ranges_[mid].first <= ch) {
+          lo = static_cast<std::uint16_t>(mid + 1U);
+        }
+        else {
+          hi = mid;
+        }
+      }
+      if (lo && (ch <= ranges_[lo - 1U].last)) {
+        range = &ranges_[lo - 1U];
+      }
+    }
+
+    if ((font_->attr & FORMAT_MASK) == FORMAT_RLE) {
+      const prop_rle_type* prop_rle = range ? static_cast<const prop_rle_type*>(range->char_info) : nullptr;
+      if (!prop_rle) {
+        // search the ranges which are not indexed
+        for (prop_rle = static_cast<const prop_rle_type*>(overflow_); prop_rle; prop_rle = prop_rle->next) {
+          if ((ch >= prop_rle->first) && (ch <= prop_rle->last)) {
+            break;
+          }
+        }
+        if (!prop_rle) {
+          return false;
+        }
+      }
+      const charinfo_rle_type* info = &prop_rle->char_info_rle[ch - prop_rle->first];
+      glyph.xsize          = info->xsize;
+      glyph.ysize          = info->ysize;
+      glyph.xpos           = info->xpos;
+      glyph.ypos           = info->ypos;
+      glyph.xdist          = info->xdist;
+      glyph.bytes_per_line = 0U;
+      glyph.data           = prop_rle->data + info->offset;
+      return true;
+    }
+    else if ((font_->attr & ENCODING_MASK) == ENCODING_UNICODE) {
+      const charinfo_ext_type* info = nullptr;
+      if (range) {
+        info = &static_cast<const charinfo_ext_type*>(range->char_info)[ch - range->first];
+      }
+      else {
+        // search the ranges which are not indexed
+        for (const prop_ext_type* prop_ext = static_cast<const prop_ext_type*>(overflow_); prop_ext; prop_ext = prop_ext->next) {
+          if ((ch >= prop_ext->first) && (ch <= prop_ext->last)) {
+            info = &prop_ext->char_info_ext[ch - prop_ext->first];
+            break;
+          }
+        }
+        if (!info) {
+          return false;
+        }
+      }
+      glyph.xsize          = info->xsize;
+      glyph.ysize          = info->ysize;
+      glyph.xpos           = info->xpos;
+      glyph.ypos           = info->ypos;
+      glyph.xdist          = info->xdist;
+      glyph.bytes_per_line = info->xsize ? static_cast<std::uint8_t>(1U + (info->xsize * samples(*font_) - 1U) * (font_->attr & AA_MASK) / 8U) : 0U;
+      glyph.data           = info->data;
+      return true;
+    }
+    else {
+      const charinfo_type* info = nullptr;
+      if (range) {
+        info = &static_cast<const charinfo_type*>(range->char_info)[ch - range->first];
+      }
+      else {
+        // search the ranges which are not indexed
+        for (const prop_type* prop = static_cast<const prop_type*>(overflow_); prop; prop = prop->next) {
+          if ((ch >= prop->first) && (ch <= prop->last)) {
+            info = &prop->char_info[ch - prop->first];
+            break;
+          }
+        }
+        if (!info) {
+          return false;
+        }
+      }
+      glyph.xsize          = info->xsize;
+      glyph.ysize          = font_->ysize;
+      glyph.xpos           = 0;
+      glyph.ypos           = 0;
+      glyph.xdist          = info->xdist;
+      glyph.bytes_per_line = info->bytes_per_line;
+      glyph.data           = info->data;
+      return true;
+    }
+  }
+
+
+private:
+
+  // insert a range into the sorted range table
+  void range_insert(std::uint32_t first, std::uint32_t last, const void* char_info)
+  {
+    std::uint16_t i = range_count_++;
+    for (; i && (ranges_[i - 1U].first > first); --i) {
+      ranges_[i] = ranges_[i - 1U];
+    }
+    ranges_[i].first     = first;
+    ranges_[i].last      = last;
+    ranges_[i].char_info = char_info;
+  }
+
+  // index range
+  typedef struct tag_range_type {
+    std::uint32_t first;          // first char code
+    std::uint32_t last;           // last char code
+    const void*   char_info;      // charinfo_type or charinfo_ext_type array, prop_rle_type node of RLE fonts
+  } range_type;
+
+  static const std::uint16_t DIRECT_FIRST = 0x20U;   // first char of the direct table
+  static const std::uint16_t DIRECT_SIZE  = 0x60U;   // chars 0x20 - 0x7F
+
+  const font_type*  font_;                            // indexed font
+  std::uint16_t     range_count_;                     // used table entries
+  const void*       overflow_;                        // first range (list node) which is not in the table
+  std::uint8_t      direct_[DIRECT_SIZE];             // range table entry + 1 of the chars 0x20 - 0x7F, 0 = not available
+  range_type        ranges_[VIC_FONT_INDEX_RANGES];   // range table, sorted by first char
+};
+
+
+/**
+ * Font set, chains several fonts for multi script text
+ * A char is rendered out of the first font of the set which contains it. The resolved font of a char
+ * is kept in a direct mapped cache, so chars which are missing in the primary font (or in all fonts)
+ * don't search the font ranges again.
+ * Glyphs of fallback fonts are aligned to the baseline of the primary font, if both fonts state a baseline.
+ */
+class font_set
+{
+public:
+
+  font_set()
+    : count_(0U)
+  {
+    cache_clear();
+  }
+
+
+  /**
+   * Add a font to the end of the chain, the first font is the primary font (line height)
+   * \param font Font to add
+   * \return false if the set is full (VIC_FONT_SET_SIZE)
+   */
+  bool add(const font_type& font)
+  {
+    if (count_ >= VIC_FONT_SET_SIZE) {
+      return false;
+    }
+    fonts_[count_++].build(font);
+    cache_clear();
+    return true;
+  }
+
+
+  /**
+   * Remove all fonts of the set
+   */
+  void clear()
+  {
+    count_ = 0U;
+    cache_clear();
+  }
+
+
+  /**
+   * Returns the primary font
+   * \return First font of the set, nullptr if the set is empty
+   */
+  inline const font_type* primary() const
+  {
+    return count_ ? fonts_[0].font() : nullptr;
+  }
+
+
+  /**
+   * Find the glyph of the given char in the fonts of the set
+   * \param ch Char code in ASCII/UNICODE
+   * \param glyph Glyph info of the char, glyph.font is the font which contains the char
+   * \return true if the char exists in any font of the set
+   */
+  bool find(std::uint32_t ch, glyph_type& glyph)
+  {
+    resolve_type& entry = cache_[ch & (VIC_FONT_SET_CACHE - 1U)];
+    if (entry.ch != ch) {
+      // resolve the font of the char
+      entry.ch   = ch;
+      entry.font = NONE;
+      for (std::uint8_t i = 0U; i < count_; ++i) {
+        if (fonts_[i].find(ch, glyph)) {
+          entry.font = i;
+          break;
+        }
+      }
+    }
+    else if ((entry.font == NONE) || !fonts_[entry.font].find(ch, glyph)) {
+      return false;
+    }
+    if (entry.font == NONE) {
+      // char is in none of the fonts
+      return false;
+    }
+    if (entry.font && fonts_[0].font()->baseline && glyph.font->baseline) {
+      // align the fallback glyph to the baseline of the primary font
+      glyph.ypos = static_cast<std::int8_t>(glyph.ypos + fonts_[0].font()->baseline - glyph.font->baseline);
+    }
+    return true;
+  }
+
+
+private:
+
+  void cache_clear()
+  {
+    for (std::uint16_t i = 0U; i < VIC_FONT_SET_CACHE; ++i) {
+      cache_[i].ch = 0xFFFFFFFFUL;    // no valid code point
+    }
+  }
+
+  static const std::uint8_t NONE = 0xFFU;   // char is in none of the fonts
+
+  // resolved font of a char
+  typedef struct tag_resolve_type {
+    std::uint32_t ch;             // char code
+    std::uint8_t  font;           // index of the font, NONE if the char is in none of the fonts
+  } resolve_type;
+
+  index         fonts_[VIC_FONT_SET_SIZE];    // glyph index of every font
+  resolve_type  cache_[VIC_FONT_SET_CACHE];   // char to font resolution cache
+  std::uint8_t  count_;                       // count of fonts in the set
+};
+
 
 ////////////////////////////////////////////////////////////////
 // CONSTANTS AND DEFINES
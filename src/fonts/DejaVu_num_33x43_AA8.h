@@ -0,0 +1,46 @@
+///////////////////////////////////////////////////////////////////////////////
+// \license The MIT License (MIT)
+//
+// This file is part of the vic library.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// \brief Prop font 43, 8 bpp, chars 0x20 - 0x3A
+// Font: -DejaVu-DejaVu
+// Copyright of the font: Copyright (c) 2003 by Bitstream, Inc. All Rights Reserved. DejaVu changes are in public domain. Bitstream Vera Fonts license
+//
+// Generated by the vic font compiler - DO NOT EDIT
+// fontc -n DejaVu_num_33x43_aa8 -b 8 -e unicode -f prop -o src/fonts/DejaVu_num_33x43_AA8 src/fonts/bdf/DejaVu_num_33x43.bdf
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _VIC_FONT_DEJAVU_NUM_33X43_AA8_H_
+#define _VIC_FONT_DEJAVU_NUM_33X43_AA8_H_
+
+#include "../font.h"
+
+
+namespace vic {
+namespace font {
+
+extern const font_type DejaVu_num_33x43_aa8;
+
+} // namespace font
+} // namespace vic
+
+#endif  // _VIC_FONT_DEJAVU_NUM_33X43_AA8_H_
@@ -0,0 +1,591 @@
+///////////////////////////////////////////////////////////////////////////////
+// \license The MIT License (MIT)
+//
+// This file is part of the vic library.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// \brief RLE compressed font 43, 8 bpp, chars 0x20 - 0x3A
+// Font: -DejaVu-DejaVu
+// Copyright of the font: Copyright (c) 2003 by Bitstream, Inc. All Rights Reserved. DejaVu changes are in public domain. Bitstream Vera Fonts license
+//
+// Generated by the vic font compiler - DO NOT EDIT
+// fontc -n DejaVu_num_33x43_aa8_rle -b 8 -e unicode -f rle -o src/fonts/DejaVu_num_33x43_AA8_RLE src/fonts/bdf/DejaVu_num_33x43.bdf
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "DejaVu_num_33x43_AA8_RLE.h"
+
+
+namespace vic {
+namespace font {
+
+static const charinfo_rle_type DejaVu_num_33x43_aa8_rle_charinfo1[1] = {
+   {   0,   0,    0,    0,  17, 0,     0U } /* code 0020 */
+};
+
+static const std::uint8_t DejaVu_num_33x43_aa8_rle_data2[] = {
+  /* code 0025 */
+  0x04, 0x00, 0x00, 0x20, 0x00, 0x7D, 0x00, 0xBF, 0x00, 0xE4, 0x00, 0xF7, 0x00, 0xF4, 0x00, 0xE0,
+  0x00, 0xB3, 0x00, 0x6F, 0x00, 0x11, 0x0E, 0x00, 0x00, 0x08, 0x00, 0xDF, 0x03, 0xFF, 0x00, 0x4B,
+  0x08, 0x00, 0x02, 0x00, 0x00, 0x08, 0x00, 0x95, 0x00, 0xFA, 0x07, 0xFF, 0x00, 0xF1, 0x00, 0x73,
+  0x0D, 0x00, 0x00, 0x7F, 0x03, 0xFF, 0x00, 0xB4, 0x09, 0x00, 0x01, 0x00, 0x00, 0x0F, 0x00, 0xCA,
+  0x0B, 0xFF, 0x00, 0xA4, 0x00, 0x01, 0x0A, 0x00, 0x00, 0x1F, 0x00, 0xF6, 0x02, 0xFF, 0x00, 0xF8,
+  0x00, 0x24, 0x09, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xB3, 0x0D, 0xFF, 0x00, 0x80, 0x0A, 0x00,
+  0x00, 0xAD, 0x03, 0xFF, 0x00, 0x85, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x53, 0x04, 0xFF, 0x00, 0xEE,
+  0x00, 0x5A, 0x00, 0x0C, 0x00, 0x15, 0x00, 0x7A, 0x00, 0xFD, 0x03, 0xFF, 0x00, 0xFB, 0x00, 0x22,
+  0x08, 0x00, 0x00, 0x45, 0x03, 0xFF, 0x00, 0xE3, 0x00, 0x0B, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xC8,
+  0x04, 0xFF, 0x00, 0x4B, 0x03, 0x00, 0x00, 0x87, 0x04, 0xFF, 0x00, 0x93, 0x07, 0x00, 0x00, 0x05,
+  0x00, 0xD6, 0x03, 0xFF, 0x00, 0x56, 0x0B, 0x00, 0x00, 0x13, 0x00, 0xFE, 0x03, 0xFF, 0x00, 0xD2,
+  0x04, 0x00, 0x00, 0x11, 0x00, 0xFB, 0x03, 0xFF, 0x00, 0xDD, 0x07, 0x00, 0x00, 0x73, 0x03, 0xFF,
+  0x00, 0xBF, 0x0C, 0x00, 0x00, 0x4A, 0x04, 0xFF, 0x00, 0x90, 0x05, 0x00, 0x00, 0xCA, 0x04, 0xFF,
+  0x00, 0x16, 0x05, 0x00, 0x00, 0x18, 0x00, 0xF1, 0x02, 0xFF, 0x00, 0xFB, 0x00, 0x2C, 0x0C, 0x00,
+  0x00, 0x61, 0x04, 0xFF, 0x00, 0x6F, 0x05, 0x00, 0x00, 0xA9, 0x04, 0xFF, 0x00, 0x2C, 0x05, 0x00,
+  0x00, 0xA2, 0x03, 0xFF, 0x00, 0x90, 0x0D, 0x00, 0x00, 0x6F, 0x04, 0xFF, 0x00, 0x66, 0x05, 0x00,
+  0x00, 0x9F, 0x04, 0xFF, 0x00, 0x3B, 0x04, 0x00, 0x00, 0x3A, 0x00, 0xFE, 0x02, 0xFF, 0x00, 0xE9,
+  0x00, 0x0F, 0x0D, 0x00, 0x00, 0x61, 0x04, 0xFF, 0x00, 0x70, 0x05, 0x00, 0x00, 0xA9, 0x04, 0xFF,
+  0x00, 0x2C, 0x03, 0x00, 0x00, 0x02, 0x00, 0xCD, 0x03, 0xFF, 0x00, 0x61, 0x0E, 0x00, 0x00, 0x49,
+  0x04, 0xFF, 0x00, 0x91, 0x05, 0x00, 0x00, 0xCA, 0x04, 0xFF, 0x00, 0x15, 0x03, 0x00, 0x00, 0x67,
+  0x03, 0xFF, 0x00, 0xC8, 0x00, 0x01, 0x0E, 0x00, 0x00, 0x12, 0x00, 0xFE, 0x03, 0xFF, 0x00, 0xD2,
+  0x04, 0x00, 0x00, 0x10, 0x00, 0xFA, 0x03, 0xFF, 0x00, 0xDC, 0x03, 0x00, 0x00, 0x12, 0x00, 0xEC,
+  0x02, 0xFF, 0x00, 0xFD, 0x00, 0x34, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x04, 0xFF, 0x00, 0x4B,
+  0x03, 0x00, 0x00, 0x83, 0x04, 0xFF, 0x00, 0x92, 0x03, 0x00, 0x00, 0x96, 0x03, 0xFF, 0x00, 0x9B,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x51, 0x04, 0xFF, 0x00, 0xEE, 0x00, 0x5A, 0x00, 0x0C, 0x00, 0x14,
+  0x00, 0x77, 0x00, 0xFC, 0x03, 0xFF, 0x00, 0xFB, 0x00, 0x21, 0x02, 0x00, 0x00, 0x30, 0x00, 0xFC,
+  0x02, 0xFF, 0x00, 0xEE, 0x00, 0x14, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xB3, 0x0D, 0xFF,
+  0x00, 0x7F, 0x03, 0x00, 0x00, 0xC3, 0x03, 0xFF, 0x00, 0x6C, 0x11, 0x00, 0x01, 0x00, 0x00, 0x0F,
+  0x00, 0xCA, 0x0B, 0xFF, 0x00, 0xA4, 0x00, 0x01, 0x02, 0x00, 0x00, 0x5C, 0x03, 0xFF, 0x00, 0xD1,
+  0x00, 0x03, 0x11, 0x00, 0x02, 0x00, 0x00, 0x08, 0x00, 0x96, 0x00, 0xFB, 0x07, 0xFF, 0x00, 0xF1,
+  0x00, 0x74, 0x03, 0x00, 0x00, 0x0C, 0x00, 0xE6, 0x03, 0xFF, 0x00, 0x3E, 0x12, 0x00, 0x04, 0x00,
+  0x00, 0x21, 0x00, 0x7E, 0x00, 0xC0, 0x00, 0xE5, 0x00, 0xF8, 0x00, 0xF5, 0x00, 0xE1, 0x00, 0xB4,
+  0x00, 0x6F, 0x00, 0x11, 0x04, 0x00, 0x00, 0x8A, 0x03, 0xFF, 0x00, 0xA5, 0x04, 0x00, 0x00, 0x0B,
+  0x00, 0x67, 0x00, 0xAC, 0x00, 0xDD, 0x00, 0xF1, 0x00, 0xF9, 0x00, 0xE6, 0x00, 0xC5, 0x00, 0x85,
+  0x00, 0x2C, 0x04, 0x00, 0x12, 0x00, 0x00, 0x27, 0x00, 0xFA, 0x02, 0xFF, 0x00, 0xF3, 0x00, 0x1A,
+  0x03, 0x00, 0x00, 0x65, 0x00, 0xEB, 0x07, 0xFF, 0x00, 0xFE, 0x00, 0xA7, 0x00, 0x10, 0x02, 0x00,
+  0x12, 0x00, 0x00, 0xB8, 0x03, 0xFF, 0x00, 0x76, 0x03, 0x00, 0x00, 0x95, 0x0B, 0xFF, 0x00, 0xDA,
+  0x00, 0x1E, 0x01, 0x00, 0x11, 0x00, 0x00, 0x50, 0x03, 0xFF, 0x00, 0xD9, 0x00, 0x06, 0x02, 0x00,
+  0x00, 0x72, 0x0D, 0xFF, 0x00, 0xCC, 0x00, 0x08, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0xDE,
+  0x03, 0xFF, 0x00, 0x47, 0x02, 0x00, 0x00, 0x19, 0x00, 0xF7, 0x04, 0xFF, 0x00, 0x89, 0x00, 0x1A,
+  0x00, 0x0A, 0x00, 0x4F, 0x00, 0xE7, 0x04, 0xFF, 0x00, 0x72, 0x00, 0x00, 0x10, 0x00, 0x00, 0x7E,
+  0x03, 0xFF, 0x00, 0xB0, 0x03, 0x00, 0x00, 0x87, 0x04, 0xFF, 0x00, 0x98, 0x03, 0x00, 0x00, 0x39,
+  0x04, 0xFF, 0x00, 0xE6, 0x00, 0x02, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0xF6, 0x02, 0xFF, 0x00, 0xF7,
+  0x00, 0x21, 0x03, 0x00, 0x00, 0xD2, 0x04, 0xFF, 0x00, 0x21, 0x04, 0x00, 0x00, 0xC1, 0x04, 0xFF,
+  0x00, 0x31, 0x0F, 0x00, 0x00, 0xAD, 0x03, 0xFF, 0x00, 0x81, 0x03, 0x00, 0x00, 0x0C, 0x00, 0xFE,
+  0x03, 0xFF, 0x00, 0xDF, 0x05, 0x00, 0x00, 0x80, 0x04, 0xFF, 0x00, 0x69, 0x0E, 0x00, 0x00, 0x44,
+  0x03, 0xFF, 0x00, 0xE0, 0x00, 0x09, 0x03, 0x00, 0x00, 0x21, 0x04, 0xFF, 0x00, 0xBF, 0x05, 0x00,
+  0x00, 0x60, 0x04, 0xFF, 0x00, 0x80, 0x0D, 0x00, 0x00, 0x04, 0x00, 0xD6, 0x03, 0xFF, 0x00, 0x52,
+  0x04, 0x00, 0x00, 0x2F, 0x04, 0xFF, 0x00, 0xB6, 0x05, 0x00, 0x00, 0x57, 0x04, 0xFF, 0x00, 0x8E,
+  0x0D, 0x00, 0x00, 0x73, 0x03, 0xFF, 0x00, 0xBB, 0x05, 0x00, 0x00, 0x20, 0x04, 0xFF, 0x00, 0xBF,
+  0x05, 0x00, 0x00, 0x61, 0x04, 0xFF, 0x00, 0x7F, 0x0C, 0x00, 0x00, 0x18, 0x00, 0xF1, 0x02, 0xFF,
+  0x00, 0xFA, 0x00, 0x28, 0x05, 0x00, 0x00, 0x0A, 0x00, 0xFD, 0x03, 0xFF, 0x00, 0xE0, 0x05, 0x00,
+  0x00, 0x80, 0x04, 0xFF, 0x00, 0x67, 0x0C, 0x00, 0x00, 0xA1, 0x03, 0xFF, 0x00, 0x8C, 0x07, 0x00,
+  0x00, 0xCF, 0x04, 0xFF, 0x00, 0x21, 0x04, 0x00, 0x00, 0xC0, 0x04, 0xFF, 0x00, 0x2D, 0x0B, 0x00,
+  0x00, 0x39, 0x00, 0xFE, 0x02, 0xFF, 0x00, 0xE7, 0x00, 0x0D, 0x07, 0x00, 0x00, 0x83, 0x04, 0xFF,
+  0x00, 0x98, 0x03, 0x00, 0x00, 0x36, 0x00, 0xFE, 0x03, 0xFF, 0x00, 0xE1, 0x00, 0x01, 0x0A, 0x00,
+  0x00, 0x02, 0x00, 0xCC, 0x03, 0xFF, 0x00, 0x5D, 0x08, 0x00, 0x00, 0x16, 0x00, 0xF6, 0x04, 0xFF,
+  0x00, 0x87, 0x00, 0x19, 0x00, 0x09, 0x00, 0x4C, 0x00, 0xE5, 0x04, 0xFF, 0x00, 0x6C, 0x00, 0x00,
+  0x0A, 0x00, 0x00, 0x67, 0x03, 0xFF, 0x00, 0xC5, 0x00, 0x01, 0x09, 0x00, 0x00, 0x6D, 0x0D, 0xFF,
+  0x00, 0xC7, 0x00, 0x06, 0x00, 0x00, 0x09, 0x00, 0x00, 0x11, 0x00, 0xEC, 0x02, 0xFF, 0x00, 0xFD,
+  0x00, 0x31, 0x0B, 0x00, 0x00, 0x91, 0x0B, 0xFF, 0x00, 0xD7, 0x00, 0x1A, 0x01, 0x00, 0x09, 0x00,
+  0x00, 0x95, 0x03, 0xFF, 0x00, 0x96, 0x0D, 0x00, 0x00, 0x63, 0x00, 0xEA, 0x07, 0xFF, 0x00, 0xFD,
+  0x00, 0xA4, 0x00, 0x0F, 0x02, 0x00, 0x08, 0x00, 0x00, 0x2F, 0x00, 0xFC, 0x02, 0xFF, 0x00, 0xED,
+  0x00, 0x12, 0x0E, 0x00, 0x00, 0x0B, 0x00, 0x66, 0x00, 0xAC, 0x00, 0xDE, 0x00, 0xF2, 0x00, 0xF9,
+  0x00, 0xE7, 0x00, 0xC5, 0x00, 0x84, 0x00, 0x2A, 0x04, 0x00
+};
+
+static const charinfo_rle_type DejaVu_num_33x43_aa8_rle_charinfo2[1] = {
+   {  46,  37,    1,    0,  48, 0,     0U } /* code 0025 */
+};
+
+static const std::uint8_t DejaVu_num_33x43_aa8_rle_data3[] = {
+  /* code 002B */
+  0x0B, 0x00, 0x00, 0xAC, 0x03, 0xFF, 0x00, 0xE8, 0x0C, 0x00, 0x0B, 0x00, 0x00, 0xAC, 0x03, 0xFF,
+  0x00, 0xE8, 0x0C, 0x00, 0x0B, 0x00, 0x00, 0xAC, 0x03, 0xFF, 0x00, 0xE8, 0x0C, 0x00, 0x0B, 0x00,
+  0x00, 0xAC, 0x03, 0xFF, 0x00, 0xE8, 0x0C, 0x00, 0x0B, 0x00, 0x00, 0xAC, 0x03, 0xFF, 0x00, 0xE8,
+  0x0C, 0x00, 0x0B, 0x00, 0x00, 0xAC, 0x03, 0xFF, 0x00, 0xE8, 0x0C, 0x00, 0x0B, 0x00, 0x00, 0xAC,
+  0x03, 0xFF, 0x00, 0xE8, 0x0C, 0x00, 0x0B, 0x00, 0x00, 0xAC, 0x03, 0xFF, 0x00, 0xE8, 0x0C, 0x00,
+  0x0B, 0x00, 0x00, 0xAC, 0x03, 0xFF, 0x00, 0xE8, 0x0C, 0x00, 0x0B, 0x00, 0x00, 0xAC, 0x03, 0xFF,
+  0x00, 0xE8, 0x0C, 0x00, 0x0B, 0x00, 0x00, 0xAC, 0x03, 0xFF, 0x00, 0xE8, 0x0C, 0x00, 0x0B, 0x00,
+  0x00, 0xAC, 0x03, 0xFF, 0x00, 0xE8, 0x0C, 0x00, 0x00, 0xE8, 0x1C, 0xFF, 0x00, 0x24, 0x00, 0xE8,
+  0x1C, 0xFF, 0x00, 0x24, 0x00, 0xE8, 0x1C, 0xFF, 0x00, 0x24, 0x00, 0xE8, 0x1C, 0xFF, 0x00, 0x24,
+  0x00, 0xE8, 0x1C, 0xFF, 0x00, 0x24, 0x00, 0xE8, 0x1C, 0xFF, 0x00, 0x24, 0x0B, 0x00, 0x00, 0xAC,
+  0x03, 0xFF, 0x00, 0xE8, 0x0C, 0x00, 0x0B, 0x00, 0x00, 0xAC, 0x03, 0xFF, 0x00, 0xE8, 0x0C, 0x00,
+  0x0B, 0x00, 0x00, 0xAC, 0x03, 0xFF, 0x00, 0xE8, 0x0C, 0x00, 0x0B, 0x00, 0x00, 0xAC, 0x03, 0xFF,
+  0x00, 0xE8, 0x0C, 0x00, 0x0B, 0x00, 0x00, 0xAC, 0x03, 0xFF, 0x00, 0xE8, 0x0C, 0x00, 0x0B, 0x00,
+  0x00, 0xAC, 0x03, 0xFF, 0x00, 0xE8, 0x0C, 0x00, 0x0B, 0x00, 0x00, 0xAC, 0x03, 0xFF, 0x00, 0xE8,
+  0x0C, 0x00, 0x0B, 0x00, 0x00, 0xAC, 0x03, 0xFF, 0x00, 0xE8, 0x0C, 0x00, 0x0B, 0x00, 0x00, 0xAC,
+  0x03, 0xFF, 0x00, 0xE8, 0x0C, 0x00, 0x0B, 0x00, 0x00, 0xAC, 0x03, 0xFF, 0x00, 0xE8, 0x0C, 0x00,
+  0x0B, 0x00, 0x00, 0xAC, 0x03, 0xFF, 0x00, 0xE8, 0x0C, 0x00, 0x0B, 0x00, 0x00, 0xAC, 0x03, 0xFF,
+  0x00, 0xE8, 0x0C, 0x00,
+  /* code 002C */
+  0x01, 0x00, 0x00, 0x18, 0x07, 0xFF, 0x00, 0x58, 0x01, 0x00, 0x00, 0x18, 0x07, 0xFF, 0x00, 0x58,
+  0x01, 0x00, 0x00, 0x18, 0x07, 0xFF, 0x00, 0x58, 0x01, 0x00, 0x00, 0x18, 0x07, 0xFF, 0x00, 0x58,
+  0x01, 0x00, 0x00, 0x18, 0x07, 0xFF, 0x00, 0x58, 0x01, 0x00, 0x00, 0x18, 0x07, 0xFF, 0x00, 0x58,
+  0x01, 0x00, 0x00, 0x18, 0x07, 0xFF, 0x00, 0x58, 0x01, 0x00, 0x00, 0x2D, 0x06, 0xFF, 0x00, 0xF9,
+  0x00, 0x28, 0x01, 0x00, 0x00, 0x71, 0x06, 0xFF, 0x00, 0x7C, 0x00, 0x00, 0x01, 0x00, 0x00, 0xB5,
+  0x05, 0xFF, 0x00, 0xCF, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0xF3, 0x04, 0xFF,
+  0x00, 0xFB, 0x00, 0x30, 0x01, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x05, 0xFF, 0x00, 0x82, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x82, 0x04, 0xFF, 0x00, 0xD3, 0x00, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0xC6,
+  0x03, 0xFF, 0x00, 0xFC, 0x00, 0x35, 0x03, 0x00, 0x00, 0x0E, 0x00, 0xFB, 0x03, 0xFF, 0x00, 0x88,
+  0x04, 0x00, 0x00, 0x4E, 0x03, 0xFF, 0x00, 0xD8, 0x00, 0x08, 0x04, 0x00,
+  /* code 002D */
+  0x00, 0x64, 0x0D, 0xFF, 0x00, 0x54, 0x00, 0x64, 0x0D, 0xFF, 0x00, 0x54, 0x00, 0x64, 0x0D, 0xFF,
+  0x00, 0x54, 0x00, 0x64, 0x0D, 0xFF, 0x00, 0x54, 0x00, 0x64, 0x0D, 0xFF, 0x00, 0x54, 0x00, 0x64,
+  0x0D, 0xFF, 0x00, 0x54, 0x00, 0x64, 0x0D, 0xFF, 0x00, 0x54,
+  /* code 002E */
+  0x00, 0x18, 0x07, 0xFF, 0x00, 0x58, 0x00, 0x18, 0x07, 0xFF, 0x00, 0x58, 0x00, 0x18, 0x07, 0xFF,
+  0x00, 0x58, 0x00, 0x18, 0x07, 0xFF, 0x00, 0x58, 0x00, 0x18, 0x07, 0xFF, 0x00, 0x58, 0x00, 0x18,
+  0x07, 0xFF, 0x00, 0x58, 0x00, 0x18, 0x07, 0xFF, 0x00, 0x58, 0x00, 0x18, 0x07, 0xFF, 0x00, 0x58,
+  0x00, 0x18, 0x07, 0xFF, 0x00, 0x58,
+  /* code 002F */
+  0x0B, 0x00, 0x00, 0xD5, 0x03, 0xFF, 0x00, 0x5E, 0x0A, 0x00, 0x00, 0x25, 0x03, 0xFF, 0x00, 0xFB,
+  0x00, 0x12, 0x0A, 0x00, 0x00, 0x76, 0x03, 0xFF, 0x00, 0xBC, 0x00, 0x00, 0x0A, 0x00, 0x00, 0xC7,
+  0x03, 0xFF, 0x00, 0x6B, 0x00, 0x00, 0x09, 0x00, 0x00, 0x19, 0x00, 0xFE, 0x02, 0xFF, 0x00, 0xFE,
+  0x00, 0x1C, 0x00, 0x00, 0x09, 0x00, 0x00, 0x69, 0x03, 0xFF, 0x00, 0xC9, 0x01, 0x00, 0x09, 0x00,
+  0x00, 0xBA, 0x03, 0xFF, 0x00, 0x78, 0x01, 0x00, 0x08, 0x00, 0x00, 0x10, 0x00, 0xFA, 0x03, 0xFF,
+  0x00, 0x28, 0x01, 0x00, 0x08, 0x00, 0x00, 0x5C, 0x03, 0xFF, 0x00, 0xD6, 0x02, 0x00, 0x08, 0x00,
+  0x00, 0xAD, 0x03, 0xFF, 0x00, 0x85, 0x02, 0x00, 0x07, 0x00, 0x00, 0x09, 0x00, 0xF4, 0x03, 0xFF,
+  0x00, 0x34, 0x02, 0x00, 0x07, 0x00, 0x00, 0x4F, 0x03, 0xFF, 0x00, 0xE3, 0x03, 0x00, 0x07, 0x00,
+  0x00, 0xA0, 0x03, 0xFF, 0x00, 0x92, 0x03, 0x00, 0x06, 0x00, 0x00, 0x03, 0x00, 0xEC, 0x03, 0xFF,
+  0x00, 0x41, 0x03, 0x00, 0x06, 0x00, 0x00, 0x41, 0x03, 0xFF, 0x00, 0xEC, 0x00, 0x04, 0x03, 0x00,
+  0x06, 0x00, 0x00, 0x92, 0x03, 0xFF, 0x00, 0x9F, 0x04, 0x00, 0x06, 0x00, 0x00, 0xE2, 0x03, 0xFF,
+  0x00, 0x4E, 0x04, 0x00, 0x05, 0x00, 0x00, 0x34, 0x03, 0xFF, 0x00, 0xF4, 0x00, 0x09, 0x04, 0x00,
+  0x05, 0x00, 0x00, 0x85, 0x03, 0xFF, 0x00, 0xAC, 0x05, 0x00, 0x05, 0x00, 0x00, 0xD6, 0x03, 0xFF,
+  0x00, 0x5B, 0x05, 0x00, 0x04, 0x00, 0x00, 0x27, 0x03, 0xFF, 0x00, 0xFA, 0x00, 0x10, 0x05, 0x00,
+  0x04, 0x00, 0x00, 0x78, 0x03, 0xFF, 0x00, 0xB9, 0x06, 0x00, 0x04, 0x00, 0x00, 0xC9, 0x03, 0xFF,
+  0x00, 0x68, 0x06, 0x00, 0x03, 0x00, 0x00, 0x1B, 0x00, 0xFE, 0x02, 0xFF, 0x00, 0xFE, 0x00, 0x19,
+  0x06, 0x00, 0x03, 0x00, 0x00, 0x6B, 0x03, 0xFF, 0x00, 0xC6, 0x07, 0x00, 0x03, 0x00, 0x00, 0xBC,
+  0x03, 0xFF, 0x00, 0x75, 0x07, 0x00, 0x02, 0x00, 0x00, 0x11, 0x00, 0xFB, 0x03, 0xFF, 0x00, 0x24,
+  0x07, 0x00, 0x02, 0x00, 0x00, 0x5D, 0x03, 0xFF, 0x00, 0xD3, 0x08, 0x00, 0x02, 0x00, 0x00, 0xAE,
+  0x03, 0xFF, 0x00, 0x82, 0x08, 0x00, 0x01, 0x00, 0x00, 0x09, 0x00, 0xF5, 0x03, 0xFF, 0x00, 0x31,
+  0x08, 0x00, 0x01, 0x00, 0x00, 0x50, 0x03, 0xFF, 0x00, 0xE0, 0x09, 0x00, 0x01, 0x00, 0x00, 0xA1,
+  0x03, 0xFF, 0x00, 0x8F, 0x09, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xED, 0x03, 0xFF, 0x00, 0x3E,
+  0x09, 0x00, 0x00, 0x00, 0x00, 0x43, 0x03, 0xFF, 0x00, 0xEA, 0x00, 0x03, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x94, 0x03, 0xFF, 0x00, 0x9C, 0x0A, 0x00, 0x00, 0x01, 0x00, 0xE3, 0x03, 0xFF, 0x00, 0x4B,
+  0x0A, 0x00, 0x00, 0x36, 0x03, 0xFF, 0x00, 0xF2, 0x00, 0x07, 0x0A, 0x00, 0x00, 0x87, 0x03, 0xFF,
+  0x00, 0xA9, 0x0B, 0x00, 0x00, 0xD8, 0x03, 0xFF, 0x00, 0x58, 0x0B, 0x00,
+  /* code 0030 */
+  0x08, 0x00, 0x00, 0x25, 0x00, 0x74, 0x00, 0xB1, 0x00, 0xD8, 0x00, 0xF1, 0x00, 0xFC, 0x00, 0xF6,
+  0x00, 0xE5, 0x00, 0xC3, 0x00, 0x8F, 0x00, 0x48, 0x00, 0x03, 0x08, 0x00, 0x06, 0x00, 0x00, 0x38,
+  0x00, 0xBC, 0x0A, 0xFF, 0x00, 0xE6, 0x00, 0x6F, 0x00, 0x06, 0x06, 0x00, 0x04, 0x00, 0x00, 0x04,
+  0x00, 0x8E, 0x00, 0xFE, 0x0D, 0xFF, 0x00, 0xD0, 0x00, 0x28, 0x05, 0x00, 0x03, 0x00, 0x00, 0x08,
+  0x00, 0xB7, 0x10, 0xFF, 0x00, 0xEE, 0x00, 0x38, 0x04, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0xAC,
+  0x12, 0xFF, 0x00, 0xED, 0x00, 0x27, 0x03, 0x00, 0x02, 0x00, 0x00, 0x6E, 0x14, 0xFF, 0x00, 0xCF,
+  0x00, 0x06, 0x02, 0x00, 0x01, 0x00, 0x00, 0x1A, 0x00, 0xF5, 0x06, 0xFF, 0x00, 0xFE, 0x00, 0x96,
+  0x00, 0x2E, 0x00, 0x0A, 0x00, 0x1A, 0x00, 0x60, 0x00, 0xE1, 0x07, 0xFF, 0x00, 0x77, 0x02, 0x00,
+  0x01, 0x00, 0x00, 0x97, 0x07, 0xFF, 0x00, 0x69, 0x04, 0x00, 0x00, 0x1B, 0x00, 0xE2, 0x06, 0xFF,
+  0x00, 0xEF, 0x00, 0x0E, 0x01, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0xF5, 0x06, 0xFF, 0x00, 0xBE,
+  0x06, 0x00, 0x00, 0x56, 0x07, 0xFF, 0x00, 0x6E, 0x01, 0x00, 0x00, 0x00, 0x00, 0x67, 0x07, 0xFF,
+  0x00, 0x54, 0x06, 0x00, 0x00, 0x03, 0x00, 0xEA, 0x06, 0xFF, 0x00, 0xCE, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0xB7, 0x06, 0xFF, 0x00, 0xFB, 0x00, 0x0A, 0x07, 0x00, 0x00, 0x9F, 0x07, 0xFF, 0x00, 0x1E,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0xF3, 0x06, 0xFF, 0x00, 0xD4, 0x08, 0x00, 0x00, 0x6E, 0x07, 0xFF,
+  0x00, 0x5E, 0x00, 0x00, 0x00, 0x2E, 0x07, 0xFF, 0x00, 0xA9, 0x08, 0x00, 0x00, 0x41, 0x07, 0xFF,
+  0x00, 0x96, 0x00, 0x00, 0x00, 0x58, 0x07, 0xFF, 0x00, 0x8E, 0x08, 0x00, 0x00, 0x27, 0x07, 0xFF,
+  0x00, 0xBF, 0x00, 0x00, 0x00, 0x7B, 0x07, 0xFF, 0x00, 0x77, 0x08, 0x00, 0x00, 0x11, 0x07, 0xFF,
+  0x00, 0xE2, 0x00, 0x00, 0x00, 0x92, 0x07, 0xFF, 0x00, 0x65, 0x09, 0x00, 0x00, 0xFE, 0x06, 0xFF,
+  0x00, 0xF9, 0x00, 0x00, 0x00, 0xA5, 0x07, 0xFF, 0x00, 0x5F, 0x09, 0x00, 0x00, 0xF8, 0x07, 0xFF,
+  0x00, 0x0C, 0x00, 0xAD, 0x07, 0xFF, 0x00, 0x59, 0x09, 0x00, 0x00, 0xF2, 0x07, 0xFF, 0x00, 0x14,
+  0x00, 0xB1, 0x07, 0xFF, 0x00, 0x54, 0x09, 0x00, 0x00, 0xED, 0x07, 0xFF, 0x00, 0x19, 0x00, 0xA6,
+  0x07, 0xFF, 0x00, 0x56, 0x09, 0x00, 0x00, 0xEF, 0x07, 0xFF, 0x00, 0x0D, 0x00, 0x98, 0x07, 0xFF,
+  0x00, 0x5B, 0x09, 0x00, 0x00, 0xF5, 0x06, 0xFF, 0x00, 0xFD, 0x00, 0x01, 0x00, 0x89, 0x07, 0xFF,
+  0x00, 0x65, 0x08, 0x00, 0x00, 0x01, 0x00, 0xFE, 0x06, 0xFF, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x79,
+  0x07, 0xFF, 0x00, 0x76, 0x08, 0x00, 0x00, 0x10, 0x07, 0xFF, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x51,
+  0x07, 0xFF, 0x00, 0x8C, 0x08, 0x00, 0x00, 0x26, 0x07, 0xFF, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x1F,
+  0x07, 0xFF, 0x00, 0xAA, 0x08, 0x00, 0x00, 0x44, 0x07, 0xFF, 0x00, 0x86, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xEE, 0x06, 0xFF, 0x00, 0xD1, 0x08, 0x00, 0x00, 0x6C, 0x07, 0xFF, 0x00, 0x55, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xB4, 0x06, 0xFF, 0x00, 0xFB, 0x00, 0x0B, 0x07, 0x00, 0x00, 0xA2, 0x06, 0xFF,
+  0x00, 0xFE, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x07, 0xFF, 0x00, 0x50, 0x06, 0x00,
+  0x00, 0x03, 0x00, 0xE9, 0x06, 0xFF, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0xF0,
+  0x06, 0xFF, 0x00, 0xC1, 0x06, 0x00, 0x00, 0x5D, 0x07, 0xFF, 0x00, 0x61, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x94, 0x07, 0xFF, 0x00, 0x6C, 0x04, 0x00, 0x00, 0x1F, 0x00, 0xE7, 0x06, 0xFF, 0x00, 0xEE,
+  0x00, 0x0D, 0x01, 0x00, 0x01, 0x00, 0x00, 0x13, 0x00, 0xEB, 0x07, 0xFF, 0x00, 0x97, 0x00, 0x2D,
+  0x00, 0x09, 0x00, 0x1A, 0x00, 0x62, 0x00, 0xE4, 0x07, 0xFF, 0x00, 0x66, 0x02, 0x00, 0x02, 0x00,
+  0x00, 0x61, 0x14, 0xFF, 0x00, 0xC6, 0x00, 0x01, 0x02, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0xAC,
+  0x12, 0xFF, 0x00, 0xED, 0x00, 0x27, 0x03, 0x00, 0x03, 0x00, 0x00, 0x08, 0x00, 0xB8, 0x10, 0xFF,
+  0x00, 0xEE, 0x00, 0x39, 0x04, 0x00, 0x04, 0x00, 0x00, 0x05, 0x00, 0x8F, 0x00, 0xFE, 0x0D, 0xFF,
+  0x00, 0xD1, 0x00, 0x28, 0x05, 0x00, 0x06, 0x00, 0x00, 0x38, 0x00, 0xBD, 0x0A, 0xFF, 0x00, 0xE6,
+  0x00, 0x71, 0x00, 0x06, 0x06, 0x00, 0x08, 0x00, 0x00, 0x25, 0x00, 0x75, 0x00, 0xB2, 0x00, 0xDA,
+  0x00, 0xF2, 0x00, 0xFC, 0x00, 0xF7, 0x00, 0xE7, 0x00, 0xC4, 0x00, 0x90, 0x00, 0x4A, 0x00, 0x04,
+  0x08, 0x00,
+  /* code 0031 */
+  0x03, 0x00, 0x00, 0x08, 0x00, 0x3F, 0x00, 0x7E, 0x00, 0xBD, 0x00, 0xF6, 0x07, 0xFF, 0x00, 0x20,
+  0x07, 0x00, 0x00, 0x0A, 0x00, 0x43, 0x00, 0x82, 0x00, 0xC1, 0x00, 0xF8, 0x0B, 0xFF, 0x00, 0x20,
+  0x07, 0x00, 0x00, 0x94, 0x0F, 0xFF, 0x00, 0x20, 0x07, 0x00, 0x00, 0x94, 0x0F, 0xFF, 0x00, 0x20,
+  0x07, 0x00, 0x00, 0x94, 0x0F, 0xFF, 0x00, 0x20, 0x07, 0x00, 0x00, 0x94, 0x0F, 0xFF, 0x00, 0x20,
+  0x07, 0x00, 0x00, 0x94, 0x02, 0xFF, 0x00, 0xF8, 0x00, 0xC2, 0x00, 0x83, 0x00, 0x45, 0x00, 0x73,
+  0x07, 0xFF, 0x00, 0x20, 0x07, 0x00, 0x00, 0x89, 0x00, 0xBD, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x08,
+  0x02, 0x00, 0x00, 0x68, 0x07, 0xFF, 0x00, 0x20, 0x07, 0x00, 0x07, 0x00, 0x00, 0x68, 0x07, 0xFF,
+  0x00, 0x20, 0x07, 0x00, 0x07, 0x00, 0x00, 0x68, 0x07, 0xFF, 0x00, 0x20, 0x07, 0x00, 0x07, 0x00,
+  0x00, 0x68, 0x07, 0xFF, 0x00, 0x20, 0x07, 0x00, 0x07, 0x00, 0x00, 0x68, 0x07, 0xFF, 0x00, 0x20,
+  0x07, 0x00, 0x07, 0x00, 0x00, 0x68, 0x07, 0xFF, 0x00, 0x20, 0x07, 0x00, 0x07, 0x00, 0x00, 0x68,
+  0x07, 0xFF, 0x00, 0x20, 0x07, 0x00, 0x07, 0x00, 0x00, 0x68, 0x07, 0xFF, 0x00, 0x20, 0x07, 0x00,
+  0x07, 0x00, 0x00, 0x68, 0x07, 0xFF, 0x00, 0x20, 0x07, 0x00, 0x07, 0x00, 0x00, 0x68, 0x07, 0xFF,
+  0x00, 0x20, 0x07, 0x00, 0x07, 0x00, 0x00, 0x68, 0x07, 0xFF, 0x00, 0x20, 0x07, 0x00, 0x07, 0x00,
+  0x00, 0x68, 0x07, 0xFF, 0x00, 0x20, 0x07, 0x00, 0x07, 0x00, 0x00, 0x68, 0x07, 0xFF, 0x00, 0x20,
+  0x07, 0x00, 0x07, 0x00, 0x00, 0x68, 0x07, 0xFF, 0x00, 0x20, 0x07, 0x00, 0x07, 0x00, 0x00, 0x68,
+  0x07, 0xFF, 0x00, 0x20, 0x07, 0x00, 0x07, 0x00, 0x00, 0x68, 0x07, 0xFF, 0x00, 0x20, 0x07, 0x00,
+  0x07, 0x00, 0x00, 0x68, 0x07, 0xFF, 0x00, 0x20, 0x07, 0x00, 0x07, 0x00, 0x00, 0x68, 0x07, 0xFF,
+  0x00, 0x20, 0x07, 0x00, 0x07, 0x00, 0x00, 0x68, 0x07, 0xFF, 0x00, 0x20, 0x07, 0x00, 0x07, 0x00,
+  0x00, 0x68, 0x07, 0xFF, 0x00, 0x20, 0x07, 0x00, 0x07, 0x00, 0x00, 0x68, 0x07, 0xFF, 0x00, 0x20,
+  0x07, 0x00, 0x07, 0x00, 0x00, 0x68, 0x07, 0xFF, 0x00, 0x20, 0x07, 0x00, 0x00, 0x60, 0x17, 0xFF,
+  0x00, 0x18, 0x00, 0x60, 0x17, 0xFF, 0x00, 0x18, 0x00, 0x60, 0x17, 0xFF, 0x00, 0x18, 0x00, 0x60,
+  0x17, 0xFF, 0x00, 0x18, 0x00, 0x60, 0x17, 0xFF, 0x00, 0x18, 0x00, 0x60, 0x17, 0xFF, 0x00, 0x18,
+  /* code 0032 */
+  0x03, 0x00, 0x00, 0x04, 0x00, 0x30, 0x00, 0x65, 0x00, 0x8F, 0x00, 0xB1, 0x00, 0xD2, 0x00, 0xE6,
+  0x00, 0xF1, 0x00, 0xFC, 0x00, 0xF4, 0x00, 0xE5, 0x00, 0xD4, 0x00, 0xAA, 0x00, 0x77, 0x00, 0x3A,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x00, 0x74, 0x00, 0xBD, 0x00, 0xF7, 0x0D, 0xFF, 0x00, 0xD9,
+  0x00, 0x73, 0x00, 0x06, 0x04, 0x00, 0x00, 0x1C, 0x13, 0xFF, 0x00, 0xD5, 0x00, 0x38, 0x03, 0x00,
+  0x00, 0x1C, 0x14, 0xFF, 0x00, 0xF6, 0x00, 0x44, 0x02, 0x00, 0x00, 0x1C, 0x15, 0xFF, 0x00, 0xF6,
+  0x00, 0x2C, 0x01, 0x00, 0x00, 0x1C, 0x16, 0xFF, 0x00, 0xC2, 0x01, 0x00, 0x00, 0x1C, 0x04, 0xFF,
+  0x00, 0xE9, 0x00, 0x94, 0x00, 0x4E, 0x00, 0x1E, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x2E, 0x00, 0x78,
+  0x00, 0xE8, 0x09, 0xFF, 0x00, 0x40, 0x00, 0x00, 0x00, 0x1C, 0x02, 0xFF, 0x00, 0xD8, 0x00, 0x60,
+  0x00, 0x04, 0x06, 0x00, 0x00, 0x14, 0x00, 0xC3, 0x08, 0xFF, 0x00, 0x91, 0x00, 0x00, 0x00, 0x1C,
+  0x00, 0xFF, 0x00, 0xEA, 0x00, 0x5F, 0x00, 0x02, 0x09, 0x00, 0x00, 0x10, 0x00, 0xE6, 0x07, 0xFF,
+  0x00, 0xCE, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x9E, 0x00, 0x12, 0x0C, 0x00, 0x00, 0x75, 0x07, 0xFF,
+  0x00, 0xE7, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x31, 0x07, 0xFF, 0x00, 0xFA, 0x00, 0x00, 0x0F, 0x00,
+  0x00, 0x1A, 0x07, 0xFF, 0x00, 0xEE, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x31, 0x07, 0xFF, 0x00, 0xCA,
+  0x00, 0x00, 0x0F, 0x00, 0x00, 0x67, 0x07, 0xFF, 0x00, 0x8C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xCE,
+  0x07, 0xFF, 0x00, 0x31, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x67, 0x07, 0xFF, 0x00, 0xB4, 0x01, 0x00,
+  0x0D, 0x00, 0x00, 0x31, 0x00, 0xF3, 0x06, 0xFF, 0x00, 0xF2, 0x00, 0x21, 0x01, 0x00, 0x0C, 0x00,
+  0x00, 0x27, 0x00, 0xEA, 0x06, 0xFF, 0x00, 0xFE, 0x00, 0x55, 0x02, 0x00, 0x0B, 0x00, 0x00, 0x38,
+  0x00, 0xEA, 0x07, 0xFF, 0x00, 0x75, 0x03, 0x00, 0x0A, 0x00, 0x00, 0x52, 0x00, 0xF6, 0x07, 0xFF,
+  0x00, 0x81, 0x04, 0x00, 0x09, 0x00, 0x00, 0x71, 0x00, 0xFD, 0x07, 0xFF, 0x00, 0x80, 0x05, 0x00,
+  0x07, 0x00, 0x00, 0x02, 0x00, 0x93, 0x07, 0xFF, 0x00, 0xFE, 0x00, 0x6D, 0x06, 0x00, 0x06, 0x00,
+  0x00, 0x0A, 0x00, 0xB1, 0x07, 0xFF, 0x00, 0xF9, 0x00, 0x59, 0x07, 0x00, 0x05, 0x00, 0x00, 0x17,
+  0x00, 0xCB, 0x07, 0xFF, 0x00, 0xEE, 0x00, 0x3F, 0x08, 0x00, 0x04, 0x00, 0x00, 0x29, 0x00, 0xDF,
+  0x07, 0xFF, 0x00, 0xDD, 0x00, 0x27, 0x09, 0x00, 0x03, 0x00, 0x00, 0x3F, 0x00, 0xEE, 0x07, 0xFF,
+  0x00, 0xC8, 0x00, 0x15, 0x0A, 0x00, 0x02, 0x00, 0x00, 0x5B, 0x00, 0xF9, 0x07, 0xFF, 0x00, 0xAD,
+  0x00, 0x09, 0x0B, 0x00, 0x01, 0x00, 0x00, 0x7B, 0x00, 0xFE, 0x07, 0xFF, 0x00, 0x8E, 0x00, 0x02,
+  0x0C, 0x00, 0x00, 0x04, 0x00, 0x9C, 0x07, 0xFF, 0x00, 0xFC, 0x00, 0x6A, 0x0E, 0x00, 0x00, 0x34,
+  0x18, 0xFF, 0x00, 0x3C, 0x00, 0x34, 0x18, 0xFF, 0x00, 0x3C, 0x00, 0x34, 0x18, 0xFF, 0x00, 0x3C,
+  0x00, 0x34, 0x18, 0xFF, 0x00, 0x3C, 0x00, 0x34, 0x18, 0xFF, 0x00, 0x3C, 0x00, 0x34, 0x18, 0xFF,
+  0x00, 0x3C, 0x00, 0x34, 0x18, 0xFF, 0x00, 0x3C,
+  /* code 0033 */
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x1C, 0x00, 0x40, 0x00, 0x64, 0x00, 0x88, 0x00, 0xAD, 0x00, 0xC5,
+  0x00, 0xD2, 0x00, 0xDE, 0x00, 0xEB, 0x00, 0xF7, 0x00, 0xFB, 0x00, 0xF0, 0x00, 0xE4, 0x00, 0xD3,
+  0x00, 0xAD, 0x00, 0x86, 0x00, 0x4F, 0x00, 0x0A, 0x06, 0x00, 0x00, 0x00, 0x00, 0x48, 0x10, 0xFF,
+  0x00, 0xF6, 0x00, 0xAA, 0x00, 0x2C, 0x04, 0x00, 0x00, 0x00, 0x00, 0x48, 0x12, 0xFF, 0x00, 0xFD,
+  0x00, 0x91, 0x00, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x48, 0x14, 0xFF, 0x00, 0xB4, 0x00, 0x03,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x48, 0x15, 0xFF, 0x00, 0x79, 0x01, 0x00, 0x00, 0x00, 0x00, 0x48,
+  0x15, 0xFF, 0x00, 0xF8, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xFF, 0x00, 0xF3,
+  0x00, 0xB2, 0x00, 0x74, 0x00, 0x48, 0x00, 0x21, 0x00, 0x10, 0x00, 0x04, 0x00, 0x0D, 0x00, 0x2D,
+  0x00, 0x69, 0x00, 0xD1, 0x09, 0xFF, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0xB2,
+  0x00, 0x4D, 0x00, 0x06, 0x08, 0x00, 0x00, 0x02, 0x00, 0x88, 0x08, 0xFF, 0x00, 0x99, 0x00, 0x00,
+  0x0F, 0x00, 0x00, 0xBF, 0x07, 0xFF, 0x00, 0xB2, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x63, 0x07, 0xFF,
+  0x00, 0xBD, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x4A, 0x07, 0xFF, 0x00, 0xAA, 0x00, 0x00, 0x0F, 0x00,
+  0x00, 0x65, 0x07, 0xFF, 0x00, 0x7A, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xBE, 0x07, 0xFF, 0x00, 0x2A,
+  0x00, 0x00, 0x0D, 0x00, 0x00, 0x02, 0x00, 0x84, 0x07, 0xFF, 0x00, 0xAC, 0x01, 0x00, 0x09, 0x00,
+  0x00, 0x05, 0x00, 0x12, 0x00, 0x35, 0x00, 0x71, 0x00, 0xD2, 0x07, 0xFF, 0x00, 0xDB, 0x00, 0x16,
+  0x01, 0x00, 0x05, 0x00, 0x00, 0xC8, 0x0E, 0xFF, 0x00, 0xC0, 0x00, 0x1A, 0x02, 0x00, 0x05, 0x00,
+  0x00, 0xC8, 0x0B, 0xFF, 0x00, 0xFD, 0x00, 0xC1, 0x00, 0x54, 0x00, 0x01, 0x03, 0x00, 0x05, 0x00,
+  0x00, 0xC8, 0x0B, 0xFF, 0x00, 0xE0, 0x00, 0x7E, 0x00, 0x1D, 0x04, 0x00, 0x05, 0x00, 0x00, 0xC8,
+  0x0D, 0xFF, 0x00, 0xF9, 0x00, 0x8F, 0x00, 0x08, 0x02, 0x00, 0x05, 0x00, 0x00, 0xC8, 0x0F, 0xFF,
+  0x00, 0xCF, 0x00, 0x13, 0x01, 0x00, 0x05, 0x00, 0x00, 0xC8, 0x10, 0xFF, 0x00, 0xC9, 0x00, 0x04,
+  0x00, 0x00, 0x09, 0x00, 0x00, 0x08, 0x00, 0x15, 0x00, 0x37, 0x00, 0x6B, 0x00, 0xBE, 0x09, 0xFF,
+  0x00, 0x76, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x40, 0x00, 0xE8, 0x07, 0xFF, 0x00, 0xE6, 0x00, 0x05,
+  0x0F, 0x00, 0x00, 0x33, 0x00, 0xFB, 0x07, 0xFF, 0x00, 0x3B, 0x10, 0x00, 0x00, 0xB2, 0x07, 0xFF,
+  0x00, 0x70, 0x10, 0x00, 0x00, 0x7F, 0x07, 0xFF, 0x00, 0x87, 0x10, 0x00, 0x00, 0x7D, 0x07, 0xFF,
+  0x00, 0x8B, 0x10, 0x00, 0x00, 0xAF, 0x07, 0xFF, 0x00, 0x72, 0x00, 0x9F, 0x00, 0x56, 0x00, 0x01,
+  0x0C, 0x00, 0x00, 0x2F, 0x00, 0xFA, 0x07, 0xFF, 0x00, 0x55, 0x00, 0xC8, 0x00, 0xFF, 0x00, 0xD1,
+  0x00, 0x68, 0x00, 0x10, 0x09, 0x00, 0x00, 0x38, 0x00, 0xE5, 0x07, 0xFF, 0x00, 0xFA, 0x00, 0x12,
+  0x00, 0xC8, 0x02, 0xFF, 0x00, 0xF7, 0x00, 0xB2, 0x00, 0x77, 0x00, 0x3E, 0x00, 0x20, 0x00, 0x0C,
+  0x00, 0x04, 0x00, 0x0F, 0x00, 0x2F, 0x00, 0x61, 0x00, 0xB4, 0x00, 0xFE, 0x08, 0xFF, 0x00, 0xB4,
+  0x00, 0x00, 0x00, 0xC8, 0x16, 0xFF, 0x00, 0xF9, 0x00, 0x2D, 0x00, 0x00, 0x00, 0xC8, 0x16, 0xFF,
+  0x00, 0x76, 0x01, 0x00, 0x00, 0xC8, 0x14, 0xFF, 0x00, 0xFE, 0x00, 0x74, 0x02, 0x00, 0x00, 0xC8,
+  0x13, 0xFF, 0x00, 0xD4, 0x00, 0x47, 0x03, 0x00, 0x00, 0x19, 0x00, 0x6C, 0x00, 0xC0, 0x00, 0xFB,
+  0x0D, 0xFF, 0x00, 0xFB, 0x00, 0xBC, 0x00, 0x5E, 0x00, 0x03, 0x04, 0x00, 0x02, 0x00, 0x00, 0x0A,
+  0x00, 0x41, 0x00, 0x7A, 0x00, 0xA1, 0x00, 0xC5, 0x00, 0xE2, 0x00, 0xEF, 0x01, 0xFA, 0x00, 0xEE,
+  0x00, 0xE1, 0x00, 0xD1, 0x00, 0xAD, 0x00, 0x83, 0x00, 0x56, 0x00, 0x12, 0x07, 0x00,
+  /* code 0034 */
+  0x0C, 0x00, 0x00, 0x31, 0x00, 0xFA, 0x08, 0xFF, 0x00, 0x34, 0x04, 0x00, 0x0B, 0x00, 0x00, 0x07,
+  0x00, 0xD3, 0x09, 0xFF, 0x00, 0x34, 0x04, 0x00, 0x0B, 0x00, 0x00, 0x8B, 0x0A, 0xFF, 0x00, 0x34,
+  0x04, 0x00, 0x0A, 0x00, 0x00, 0x3D, 0x00, 0xFD, 0x0A, 0xFF, 0x00, 0x34, 0x04, 0x00, 0x09, 0x00,
+  0x00, 0x0C, 0x00, 0xDD, 0x0B, 0xFF, 0x00, 0x34, 0x04, 0x00, 0x09, 0x00, 0x00, 0x9A, 0x0C, 0xFF,
+  0x00, 0x34, 0x04, 0x00, 0x08, 0x00, 0x00, 0x49, 0x0D, 0xFF, 0x00, 0x34, 0x04, 0x00, 0x07, 0x00,
+  0x00, 0x12, 0x00, 0xE6, 0x04, 0xFF, 0x00, 0xE1, 0x07, 0xFF, 0x00, 0x34, 0x04, 0x00, 0x07, 0x00,
+  0x00, 0xA8, 0x04, 0xFF, 0x00, 0xE0, 0x00, 0x61, 0x07, 0xFF, 0x00, 0x34, 0x04, 0x00, 0x06, 0x00,
+  0x00, 0x58, 0x04, 0xFF, 0x00, 0xFE, 0x00, 0x42, 0x00, 0x54, 0x07, 0xFF, 0x00, 0x34, 0x04, 0x00,
+  0x05, 0x00, 0x00, 0x19, 0x00, 0xED, 0x04, 0xFF, 0x00, 0x92, 0x00, 0x00, 0x00, 0x54, 0x07, 0xFF,
+  0x00, 0x34, 0x04, 0x00, 0x05, 0x00, 0x00, 0xB6, 0x04, 0xFF, 0x00, 0xDB, 0x00, 0x0A, 0x00, 0x00,
+  0x00, 0x54, 0x07, 0xFF, 0x00, 0x34, 0x04, 0x00, 0x04, 0x00, 0x00, 0x67, 0x04, 0xFF, 0x00, 0xFD,
+  0x00, 0x3A, 0x01, 0x00, 0x00, 0x54, 0x07, 0xFF, 0x00, 0x34, 0x04, 0x00, 0x03, 0x00, 0x00, 0x22,
+  0x00, 0xF3, 0x04, 0xFF, 0x00, 0x8A, 0x02, 0x00, 0x00, 0x54, 0x07, 0xFF, 0x00, 0x34, 0x04, 0x00,
+  0x02, 0x00, 0x00, 0x02, 0x00, 0xC2, 0x04, 0xFF, 0x00, 0xD5, 0x00, 0x07, 0x02, 0x00, 0x00, 0x54,
+  0x07, 0xFF, 0x00, 0x34, 0x04, 0x00, 0x02, 0x00, 0x00, 0x75, 0x04, 0xFF, 0x00, 0xFB, 0x00, 0x34,
+  0x03, 0x00, 0x00, 0x54, 0x07, 0xFF, 0x00, 0x34, 0x04, 0x00, 0x01, 0x00, 0x00, 0x2C, 0x00, 0xF8,
+  0x04, 0xFF, 0x00, 0x81, 0x04, 0x00, 0x00, 0x54, 0x07, 0xFF, 0x00, 0x34, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x05, 0x00, 0xCE, 0x04, 0xFF, 0x00, 0xCF, 0x00, 0x05, 0x04, 0x00, 0x00, 0x54, 0x07, 0xFF,
+  0x00, 0x34, 0x04, 0x00, 0x00, 0x00, 0x00, 0x84, 0x04, 0xFF, 0x00, 0xF9, 0x00, 0x2D, 0x05, 0x00,
+  0x00, 0x54, 0x07, 0xFF, 0x00, 0x34, 0x04, 0x00, 0x00, 0x37, 0x00, 0xFC, 0x04, 0xFF, 0x00, 0x79,
+  0x06, 0x00, 0x00, 0x54, 0x07, 0xFF, 0x00, 0x34, 0x04, 0x00, 0x00, 0xC7, 0x04, 0xFF, 0x00, 0xC8,
+  0x00, 0x03, 0x06, 0x00, 0x00, 0x54, 0x07, 0xFF, 0x00, 0x34, 0x04, 0x00, 0x00, 0xD8, 0x03, 0xFF,
+  0x00, 0xF7, 0x00, 0x27, 0x07, 0x00, 0x00, 0x54, 0x07, 0xFF, 0x00, 0x34, 0x04, 0x00, 0x00, 0xD8,
+  0x1B, 0xFF, 0x00, 0x34, 0x00, 0xD8, 0x1B, 0xFF, 0x00, 0x34, 0x00, 0xD8, 0x1B, 0xFF, 0x00, 0x34,
+  0x00, 0xD8, 0x1B, 0xFF, 0x00, 0x34, 0x00, 0xD8, 0x1B, 0xFF, 0x00, 0x34, 0x00, 0xD8, 0x1B, 0xFF,
+  0x00, 0x34, 0x0E, 0x00, 0x00, 0x54, 0x07, 0xFF, 0x00, 0x34, 0x04, 0x00, 0x0E, 0x00, 0x00, 0x54,
+  0x07, 0xFF, 0x00, 0x34, 0x04, 0x00, 0x0E, 0x00, 0x00, 0x54, 0x07, 0xFF, 0x00, 0x34, 0x04, 0x00,
+  0x0E, 0x00, 0x00, 0x54, 0x07, 0xFF, 0x00, 0x34, 0x04, 0x00, 0x0E, 0x00, 0x00, 0x54, 0x07, 0xFF,
+  0x00, 0x34, 0x04, 0x00, 0x0E, 0x00, 0x00, 0x54, 0x07, 0xFF, 0x00, 0x34, 0x04, 0x00, 0x0E, 0x00,
+  0x00, 0x54, 0x07, 0xFF, 0x00, 0x34, 0x04, 0x00,
+  /* code 0035 */
+  0x01, 0x00, 0x00, 0xE8, 0x14, 0xFF, 0x00, 0x84, 0x02, 0x00, 0x01, 0x00, 0x00, 0xE8, 0x14, 0xFF,
+  0x00, 0x84, 0x02, 0x00, 0x01, 0x00, 0x00, 0xE8, 0x14, 0xFF, 0x00, 0x84, 0x02, 0x00, 0x01, 0x00,
+  0x00, 0xE8, 0x14, 0xFF, 0x00, 0x84, 0x02, 0x00, 0x01, 0x00, 0x00, 0xE8, 0x14, 0xFF, 0x00, 0x84,
+  0x02, 0x00, 0x01, 0x00, 0x00, 0xE8, 0x14, 0xFF, 0x00, 0x84, 0x02, 0x00, 0x01, 0x00, 0x00, 0xE8,
+  0x14, 0xFF, 0x00, 0x84, 0x02, 0x00, 0x01, 0x00, 0x00, 0xE8, 0x05, 0xFF, 0x00, 0x48, 0x11, 0x00,
+  0x01, 0x00, 0x00, 0xE8, 0x05, 0xFF, 0x00, 0x48, 0x11, 0x00, 0x01, 0x00, 0x00, 0xE8, 0x05, 0xFF,
+  0x00, 0x48, 0x11, 0x00, 0x01, 0x00, 0x00, 0xE8, 0x05, 0xFF, 0x00, 0x48, 0x11, 0x00, 0x01, 0x00,
+  0x00, 0xE8, 0x05, 0xFF, 0x00, 0x48, 0x11, 0x00, 0x01, 0x00, 0x00, 0xE8, 0x05, 0xFF, 0x00, 0xA2,
+  0x00, 0xAB, 0x00, 0xD8, 0x00, 0xEC, 0x00, 0xFB, 0x00, 0xEF, 0x00, 0xDE, 0x00, 0xC9, 0x00, 0x96,
+  0x00, 0x5D, 0x00, 0x19, 0x07, 0x00, 0x01, 0x00, 0x00, 0xE8, 0x0F, 0xFF, 0x00, 0xFA, 0x00, 0xA7,
+  0x00, 0x33, 0x05, 0x00, 0x01, 0x00, 0x00, 0xE8, 0x11, 0xFF, 0x00, 0xFD, 0x00, 0x85, 0x00, 0x05,
+  0x03, 0x00, 0x01, 0x00, 0x00, 0xE8, 0x13, 0xFF, 0x00, 0xBD, 0x00, 0x07, 0x02, 0x00, 0x01, 0x00,
+  0x00, 0xE8, 0x14, 0xFF, 0x00, 0xA9, 0x00, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0xE8, 0x15, 0xFF,
+  0x00, 0x5B, 0x01, 0x00, 0x01, 0x00, 0x00, 0xE8, 0x01, 0xFF, 0x00, 0xDC, 0x00, 0x97, 0x00, 0x62,
+  0x00, 0x35, 0x00, 0x18, 0x00, 0x07, 0x00, 0x09, 0x00, 0x1D, 0x00, 0x50, 0x00, 0xA6, 0x00, 0xFA,
+  0x08, 0xFF, 0x00, 0xDF, 0x00, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0xC2, 0x00, 0x7F, 0x00, 0x24,
+  0x09, 0x00, 0x00, 0x31, 0x00, 0xDE, 0x08, 0xFF, 0x00, 0x4E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x21,
+  0x00, 0xF1, 0x07, 0xFF, 0x00, 0x96, 0x00, 0x00, 0x10, 0x00, 0x00, 0x7B, 0x07, 0xFF, 0x00, 0xD3,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x28, 0x07, 0xFF, 0x00, 0xEB, 0x00, 0x00, 0x10, 0x00, 0x00, 0x05,
+  0x00, 0xFE, 0x06, 0xFF, 0x00, 0xFD, 0x00, 0x03, 0x10, 0x00, 0x00, 0x05, 0x00, 0xFE, 0x06, 0xFF,
+  0x00, 0xFD, 0x00, 0x03, 0x10, 0x00, 0x00, 0x28, 0x07, 0xFF, 0x00, 0xE9, 0x00, 0x00, 0x10, 0x00,
+  0x00, 0x7C, 0x07, 0xFF, 0x00, 0xCE, 0x00, 0x00, 0x00, 0x46, 0x00, 0x9F, 0x00, 0x28, 0x0C, 0x00,
+  0x00, 0x21, 0x00, 0xF1, 0x07, 0xFF, 0x00, 0x8C, 0x00, 0x00, 0x00, 0x4C, 0x00, 0xFF, 0x00, 0xFE,
+  0x00, 0xB2, 0x00, 0x53, 0x00, 0x07, 0x08, 0x00, 0x00, 0x31, 0x00, 0xDE, 0x08, 0xFF, 0x00, 0x3D,
+  0x00, 0x00, 0x00, 0x4C, 0x03, 0xFF, 0x00, 0xF0, 0x00, 0xAA, 0x00, 0x70, 0x00, 0x39, 0x00, 0x1D,
+  0x00, 0x09, 0x00, 0x08, 0x00, 0x1D, 0x00, 0x50, 0x00, 0xA6, 0x00, 0xFA, 0x08, 0xFF, 0x00, 0xCA,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x4C, 0x16, 0xFF, 0x00, 0xFE, 0x00, 0x37, 0x01, 0x00, 0x00, 0x4C,
+  0x16, 0xFF, 0x00, 0x75, 0x02, 0x00, 0x00, 0x4C, 0x15, 0xFF, 0x00, 0x7B, 0x03, 0x00, 0x00, 0x4C,
+  0x13, 0xFF, 0x00, 0xDF, 0x00, 0x44, 0x04, 0x00, 0x00, 0x03, 0x00, 0x3F, 0x00, 0x8D, 0x00, 0xD9,
+  0x0E, 0xFF, 0x00, 0xD4, 0x00, 0x6F, 0x00, 0x0B, 0x05, 0x00, 0x03, 0x00, 0x00, 0x15, 0x00, 0x4D,
+  0x00, 0x81, 0x00, 0xA4, 0x00, 0xC4, 0x00, 0xDF, 0x00, 0xEC, 0x00, 0xF7, 0x00, 0xFC, 0x00, 0xEF,
+  0x00, 0xE0, 0x00, 0xCE, 0x00, 0xA1, 0x00, 0x6C, 0x00, 0x32, 0x08, 0x00,
+  /* code 0036 */
+  0x0A, 0x00, 0x00, 0x16, 0x00, 0x62, 0x00, 0x9F, 0x00, 0xC8, 0x00, 0xE8, 0x00, 0xF6, 0x00, 0xFC,
+  0x00, 0xF0, 0x00, 0xE1, 0x00, 0xBF, 0x00, 0x95, 0x00, 0x5E, 0x00, 0x18, 0x04, 0x00, 0x08, 0x00,
+  0x00, 0x38, 0x00, 0xB2, 0x00, 0xFC, 0x0B, 0xFF, 0x00, 0xCA, 0x00, 0x67, 0x00, 0x0E, 0x01, 0x00,
+  0x06, 0x00, 0x00, 0x12, 0x00, 0xA2, 0x10, 0xFF, 0x00, 0x88, 0x01, 0x00, 0x05, 0x00, 0x00, 0x2B,
+  0x00, 0xDE, 0x11, 0xFF, 0x00, 0x88, 0x01, 0x00, 0x04, 0x00, 0x00, 0x2C, 0x00, 0xEC, 0x12, 0xFF,
+  0x00, 0x88, 0x01, 0x00, 0x03, 0x00, 0x00, 0x16, 0x00, 0xE4, 0x13, 0xFF, 0x00, 0x88, 0x01, 0x00,
+  0x03, 0x00, 0x00, 0xB9, 0x08, 0xFF, 0x00, 0xCA, 0x00, 0x6F, 0x00, 0x2F, 0x00, 0x14, 0x00, 0x04,
+  0x00, 0x11, 0x00, 0x28, 0x00, 0x57, 0x00, 0x8F, 0x00, 0xDB, 0x01, 0xFF, 0x00, 0x88, 0x01, 0x00,
+  0x02, 0x00, 0x00, 0x5A, 0x07, 0xFF, 0x00, 0xF1, 0x00, 0x54, 0x09, 0x00, 0x00, 0x2E, 0x00, 0x95,
+  0x00, 0x79, 0x01, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0xDD, 0x06, 0xFF, 0x00, 0xF2, 0x00, 0x2D,
+  0x0F, 0x00, 0x01, 0x00, 0x00, 0x57, 0x07, 0xFF, 0x00, 0x59, 0x10, 0x00, 0x01, 0x00, 0x00, 0xB8,
+  0x06, 0xFF, 0x00, 0xCD, 0x11, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0xFB, 0x06, 0xFF, 0x00, 0x5E,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x4E, 0x06, 0xFF, 0x00, 0xFE, 0x00, 0x15, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x84, 0x06, 0xFF, 0x00, 0xD7, 0x01, 0x00, 0x00, 0x39, 0x00, 0x8A, 0x00, 0xC5, 0x00, 0xE6,
+  0x00, 0xF8, 0x00, 0xF3, 0x00, 0xDF, 0x00, 0xC3, 0x00, 0x85, 0x00, 0x40, 0x00, 0x01, 0x05, 0x00,
+  0x00, 0x00, 0x00, 0xB1, 0x06, 0xFF, 0x00, 0xB3, 0x00, 0x3A, 0x00, 0xCB, 0x09, 0xFF, 0x00, 0xD2,
+  0x00, 0x54, 0x04, 0x00, 0x00, 0x00, 0x00, 0xD1, 0x06, 0xFF, 0x00, 0xE8, 0x00, 0xFD, 0x0C, 0xFF,
+  0x00, 0xA1, 0x00, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x16, 0xFF, 0x00, 0xC4, 0x00, 0x07,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x17, 0xFF, 0x00, 0xA5, 0x01, 0x00, 0x00, 0x01, 0x19, 0xFF,
+  0x00, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x09, 0xFF, 0x00, 0xD4, 0x00, 0x54, 0x00, 0x15,
+  0x00, 0x06, 0x00, 0x1F, 0x00, 0x6D, 0x00, 0xEC, 0x07, 0xFF, 0x00, 0xD1, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0xEE, 0x08, 0xFF, 0x00, 0xCF, 0x00, 0x0C, 0x04, 0x00, 0x00, 0x29, 0x00, 0xF3, 0x07, 0xFF,
+  0x00, 0x30, 0x00, 0x00, 0x00, 0xE0, 0x08, 0xFF, 0x00, 0x41, 0x06, 0x00, 0x00, 0x80, 0x07, 0xFF,
+  0x00, 0x78, 0x00, 0x00, 0x00, 0xD1, 0x07, 0xFF, 0x00, 0xEA, 0x00, 0x01, 0x06, 0x00, 0x00, 0x29,
+  0x07, 0xFF, 0x00, 0xA8, 0x00, 0x00, 0x00, 0xB1, 0x07, 0xFF, 0x00, 0xBC, 0x07, 0x00, 0x00, 0x02,
+  0x00, 0xF7, 0x06, 0xFF, 0x00, 0xBE, 0x00, 0x00, 0x00, 0x80, 0x07, 0xFF, 0x00, 0xAA, 0x08, 0x00,
+  0x00, 0xE7, 0x06, 0xFF, 0x00, 0xCE, 0x00, 0x00, 0x00, 0x4D, 0x07, 0xFF, 0x00, 0xA9, 0x08, 0x00,
+  0x00, 0xE7, 0x06, 0xFF, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x18, 0x00, 0xFE, 0x06, 0xFF, 0x00, 0xBC,
+  0x07, 0x00, 0x00, 0x02, 0x00, 0xF7, 0x06, 0xFF, 0x00, 0xA7, 0x01, 0x00, 0x00, 0xC0, 0x06, 0xFF,
+  0x00, 0xEA, 0x00, 0x01, 0x06, 0x00, 0x00, 0x29, 0x07, 0xFF, 0x00, 0x80, 0x01, 0x00, 0x00, 0x5F,
+  0x07, 0xFF, 0x00, 0x41, 0x06, 0x00, 0x00, 0x80, 0x07, 0xFF, 0x00, 0x37, 0x01, 0x00, 0x00, 0x0B,
+  0x00, 0xF0, 0x06, 0xFF, 0x00, 0xCF, 0x00, 0x0C, 0x04, 0x00, 0x00, 0x29, 0x00, 0xF3, 0x06, 0xFF,
+  0x00, 0xE6, 0x00, 0x02, 0x02, 0x00, 0x00, 0x6B, 0x07, 0xFF, 0x00, 0xD4, 0x00, 0x53, 0x00, 0x14,
+  0x00, 0x05, 0x00, 0x1E, 0x00, 0x6D, 0x00, 0xEC, 0x07, 0xFF, 0x00, 0x6A, 0x00, 0x00, 0x02, 0x00,
+  0x00, 0x02, 0x00, 0xC6, 0x14, 0xFF, 0x00, 0xD8, 0x00, 0x05, 0x00, 0x00, 0x03, 0x00, 0x00, 0x27,
+  0x00, 0xEE, 0x12, 0xFF, 0x00, 0xED, 0x00, 0x27, 0x01, 0x00, 0x04, 0x00, 0x00, 0x3B, 0x00, 0xEF,
+  0x10, 0xFF, 0x00, 0xEF, 0x00, 0x3B, 0x02, 0x00, 0x05, 0x00, 0x00, 0x2A, 0x00, 0xD2, 0x0E, 0xFF,
+  0x00, 0xC9, 0x00, 0x20, 0x03, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x72, 0x00, 0xE7, 0x0A, 0xFF,
+  0x00, 0xD5, 0x00, 0x61, 0x00, 0x05, 0x04, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00, 0x4A, 0x00, 0x91,
+  0x00, 0xC5, 0x00, 0xE8, 0x00, 0xF8, 0x00, 0xFA, 0x00, 0xEA, 0x00, 0xD7, 0x00, 0xB7, 0x00, 0x79,
+  0x00, 0x39, 0x00, 0x01, 0x06, 0x00,
+  /* code 0037 */
+  0x00, 0xC8, 0x18, 0xFF, 0x00, 0x94, 0x00, 0xC8, 0x18, 0xFF, 0x00, 0x94, 0x00, 0xC8, 0x18, 0xFF,
+  0x00, 0x94, 0x00, 0xC8, 0x18, 0xFF, 0x00, 0x94, 0x00, 0xC8, 0x18, 0xFF, 0x00, 0x94, 0x00, 0xC8,
+  0x18, 0xFF, 0x00, 0x63, 0x00, 0xC8, 0x17, 0xFF, 0x00, 0xE8, 0x00, 0x07, 0x0F, 0x00, 0x00, 0x2C,
+  0x00, 0xFE, 0x06, 0xFF, 0x00, 0x7A, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xA2, 0x06, 0xFF, 0x00, 0xF4,
+  0x00, 0x11, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00, 0xFA, 0x06, 0xFF, 0x00, 0x91, 0x01, 0x00,
+  0x0E, 0x00, 0x00, 0x8E, 0x06, 0xFF, 0x00, 0xFC, 0x00, 0x20, 0x01, 0x00, 0x0D, 0x00, 0x00, 0x10,
+  0x00, 0xF2, 0x06, 0xFF, 0x00, 0xA7, 0x02, 0x00, 0x0D, 0x00, 0x00, 0x7A, 0x07, 0xFF, 0x00, 0x33,
+  0x02, 0x00, 0x0C, 0x00, 0x00, 0x07, 0x00, 0xE7, 0x06, 0xFF, 0x00, 0xBE, 0x03, 0x00, 0x0C, 0x00,
+  0x00, 0x66, 0x07, 0xFF, 0x00, 0x49, 0x03, 0x00, 0x0B, 0x00, 0x00, 0x02, 0x00, 0xD9, 0x06, 0xFF,
+  0x00, 0xD3, 0x04, 0x00, 0x0B, 0x00, 0x00, 0x52, 0x07, 0xFF, 0x00, 0x5F, 0x04, 0x00, 0x0B, 0x00,
+  0x00, 0xC7, 0x06, 0xFF, 0x00, 0xE5, 0x00, 0x05, 0x04, 0x00, 0x0A, 0x00, 0x00, 0x3E, 0x07, 0xFF,
+  0x00, 0x76, 0x05, 0x00, 0x0A, 0x00, 0x00, 0xB4, 0x06, 0xFF, 0x00, 0xF2, 0x00, 0x0F, 0x05, 0x00,
+  0x09, 0x00, 0x00, 0x2A, 0x00, 0xFE, 0x06, 0xFF, 0x00, 0x8C, 0x06, 0x00, 0x09, 0x00, 0x00, 0xA0,
+  0x06, 0xFF, 0x00, 0xFA, 0x00, 0x1D, 0x06, 0x00, 0x08, 0x00, 0x00, 0x1B, 0x00, 0xFA, 0x06, 0xFF,
+  0x00, 0xA3, 0x07, 0x00, 0x08, 0x00, 0x00, 0x8C, 0x07, 0xFF, 0x00, 0x2F, 0x07, 0x00, 0x07, 0x00,
+  0x00, 0x0F, 0x00, 0xF1, 0x06, 0xFF, 0x00, 0xB9, 0x08, 0x00, 0x07, 0x00, 0x00, 0x78, 0x07, 0xFF,
+  0x00, 0x44, 0x08, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0xE6, 0x06, 0xFF, 0x00, 0xCF, 0x09, 0x00,
+  0x06, 0x00, 0x00, 0x64, 0x07, 0xFF, 0x00, 0x5B, 0x09, 0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0xD7,
+  0x06, 0xFF, 0x00, 0xE2, 0x00, 0x04, 0x09, 0x00, 0x05, 0x00, 0x00, 0x50, 0x07, 0xFF, 0x00, 0x71,
+  0x0A, 0x00, 0x05, 0x00, 0x00, 0xC5, 0x06, 0xFF, 0x00, 0xF0, 0x00, 0x0D, 0x0A, 0x00, 0x04, 0x00,
+  0x00, 0x3B, 0x07, 0xFF, 0x00, 0x88, 0x0B, 0x00, 0x04, 0x00, 0x00, 0xB2, 0x06, 0xFF, 0x00, 0xF9,
+  0x00, 0x1A, 0x0B, 0x00, 0x03, 0x00, 0x00, 0x28, 0x00, 0xFE, 0x06, 0xFF, 0x00, 0x9E, 0x0C, 0x00,
+  0x03, 0x00, 0x00, 0x9D, 0x06, 0xFF, 0x00, 0xFE, 0x00, 0x2B, 0x0C, 0x00,
+  /* code 0038 */
+  0x06, 0x00, 0x00, 0x02, 0x00, 0x3C, 0x00, 0x7E, 0x00, 0xA8, 0x00, 0xD0, 0x00, 0xE4, 0x00, 0xF0,
+  0x00, 0xFC, 0x00, 0xF6, 0x00, 0xE9, 0x00, 0xDB, 0x00, 0xB8, 0x00, 0x8E, 0x00, 0x5A, 0x00, 0x0F,
+  0x06, 0x00, 0x04, 0x00, 0x00, 0x0E, 0x00, 0x83, 0x00, 0xE8, 0x0C, 0xFF, 0x00, 0xF9, 0x00, 0xAF,
+  0x00, 0x2D, 0x04, 0x00, 0x03, 0x00, 0x00, 0x47, 0x00, 0xEB, 0x10, 0xFF, 0x00, 0xFD, 0x00, 0x8E,
+  0x00, 0x02, 0x02, 0x00, 0x02, 0x00, 0x00, 0x55, 0x00, 0xFB, 0x13, 0xFF, 0x00, 0xAD, 0x00, 0x01,
+  0x01, 0x00, 0x01, 0x00, 0x00, 0x1D, 0x00, 0xF1, 0x15, 0xFF, 0x00, 0x6E, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x9A, 0x16, 0xFF, 0x00, 0xF1, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0xED,
+  0x07, 0xFF, 0x00, 0xE5, 0x00, 0x65, 0x00, 0x1E, 0x00, 0x05, 0x00, 0x0F, 0x00, 0x42, 0x00, 0xB6,
+  0x08, 0xFF, 0x00, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x07, 0xFF, 0x00, 0xE8, 0x00, 0x1B,
+  0x05, 0x00, 0x00, 0xA5, 0x07, 0xFF, 0x00, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x07, 0xFF,
+  0x00, 0x7A, 0x06, 0x00, 0x00, 0x1E, 0x07, 0xFF, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+  0x07, 0xFF, 0x00, 0x45, 0x07, 0x00, 0x00, 0xEA, 0x06, 0xFF, 0x00, 0xA2, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x29, 0x07, 0xFF, 0x00, 0x46, 0x07, 0x00, 0x00, 0xEB, 0x06, 0xFF, 0x00, 0x88, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0xEC, 0x06, 0xFF, 0x00, 0x7A, 0x06, 0x00, 0x00, 0x1F, 0x07, 0xFF,
+  0x00, 0x4D, 0x00, 0x00, 0x01, 0x00, 0x00, 0x8C, 0x06, 0xFF, 0x00, 0xE8, 0x00, 0x19, 0x05, 0x00,
+  0x00, 0xA5, 0x06, 0xFF, 0x00, 0xE5, 0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x12, 0x00, 0xE6,
+  0x06, 0xFF, 0x00, 0xE3, 0x00, 0x63, 0x00, 0x1C, 0x00, 0x04, 0x00, 0x0E, 0x00, 0x41, 0x00, 0xB5,
+  0x07, 0xFF, 0x00, 0x54, 0x01, 0x00, 0x02, 0x00, 0x00, 0x30, 0x00, 0xEC, 0x13, 0xFF, 0x00, 0x79,
+  0x02, 0x00, 0x03, 0x00, 0x00, 0x1C, 0x00, 0xB7, 0x10, 0xFF, 0x00, 0xE2, 0x00, 0x4D, 0x03, 0x00,
+  0x05, 0x00, 0x00, 0x3A, 0x00, 0xA3, 0x00, 0xFE, 0x0B, 0xFF, 0x00, 0xCF, 0x00, 0x62, 0x00, 0x06,
+  0x04, 0x00, 0x04, 0x00, 0x00, 0x19, 0x00, 0x8E, 0x00, 0xEA, 0x0C, 0xFF, 0x00, 0xFA, 0x00, 0xB3,
+  0x00, 0x3F, 0x04, 0x00, 0x03, 0x00, 0x00, 0x6E, 0x00, 0xF6, 0x11, 0xFF, 0x00, 0xAF, 0x00, 0x12,
+  0x02, 0x00, 0x02, 0x00, 0x00, 0x98, 0x14, 0xFF, 0x00, 0xDB, 0x00, 0x18, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x72, 0x07, 0xFF, 0x00, 0xDA, 0x00, 0x62, 0x00, 0x1E, 0x00, 0x05, 0x00, 0x0F, 0x00, 0x3F,
+  0x00, 0xA6, 0x07, 0xFF, 0x00, 0xCA, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0xF5,
+  0x06, 0xFF, 0x00, 0xC5, 0x00, 0x0D, 0x05, 0x00, 0x00, 0x6F, 0x07, 0xFF, 0x00, 0x69, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x7B, 0x06, 0xFF, 0x00, 0xFC, 0x00, 0x21, 0x07, 0x00, 0x00, 0xBE, 0x06, 0xFF,
+  0x00, 0xD6, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 0x06, 0xFF, 0x00, 0xBB, 0x08, 0x00, 0x00, 0x5E,
+  0x07, 0xFF, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF3, 0x06, 0xFF, 0x00, 0x8A, 0x08, 0x00, 0x00, 0x2F,
+  0x07, 0xFF, 0x00, 0x4F, 0x00, 0x07, 0x07, 0xFF, 0x00, 0x7C, 0x08, 0x00, 0x00, 0x20, 0x07, 0xFF,
+  0x00, 0x62, 0x00, 0x06, 0x07, 0xFF, 0x00, 0x89, 0x08, 0x00, 0x00, 0x2E, 0x07, 0xFF, 0x00, 0x61,
+  0x00, 0x00, 0x00, 0xF0, 0x06, 0xFF, 0x00, 0xB9, 0x08, 0x00, 0x00, 0x5D, 0x07, 0xFF, 0x00, 0x4B,
+  0x00, 0x00, 0x00, 0xD5, 0x06, 0xFF, 0x00, 0xFB, 0x00, 0x1E, 0x07, 0x00, 0x00, 0xBC, 0x07, 0xFF,
+  0x00, 0x30, 0x00, 0x00, 0x00, 0x93, 0x07, 0xFF, 0x00, 0xC0, 0x00, 0x0A, 0x05, 0x00, 0x00, 0x6B,
+  0x07, 0xFF, 0x00, 0xEC, 0x00, 0x02, 0x00, 0x00, 0x00, 0x46, 0x08, 0xFF, 0x00, 0xD7, 0x00, 0x5F,
+  0x00, 0x1C, 0x00, 0x05, 0x00, 0x0E, 0x00, 0x3D, 0x00, 0xA4, 0x08, 0xFF, 0x00, 0xA2, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0xC8, 0x16, 0xFF, 0x00, 0xFB, 0x00, 0x2A, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x37, 0x00, 0xFA, 0x15, 0xFF, 0x00, 0x8E, 0x01, 0x00, 0x02, 0x00, 0x00, 0x54, 0x00, 0xFB,
+  0x13, 0xFF, 0x00, 0xAA, 0x00, 0x03, 0x01, 0x00, 0x03, 0x00, 0x00, 0x46, 0x00, 0xDF, 0x10, 0xFF,
+  0x00, 0xFA, 0x00, 0x87, 0x00, 0x05, 0x02, 0x00, 0x04, 0x00, 0x00, 0x0A, 0x00, 0x7B, 0x00, 0xDC,
+  0x0C, 0xFF, 0x00, 0xF5, 0x00, 0xA4, 0x00, 0x2C, 0x04, 0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x74,
+  0x00, 0xA4, 0x00, 0xCF, 0x00, 0xE2, 0x00, 0xF0, 0x00, 0xFC, 0x00, 0xF6, 0x00, 0xE8, 0x00, 0xD9,
+  0x00, 0xB8, 0x00, 0x88, 0x00, 0x55, 0x00, 0x0C, 0x06, 0x00,
+  /* code 0039 */
+  0x07, 0x00, 0x00, 0x23, 0x00, 0x66, 0x00, 0xA5, 0x00, 0xD0, 0x00, 0xE3, 0x00, 0xF6, 0x00, 0xF9,
+  0x00, 0xEC, 0x00, 0xCD, 0x00, 0xA0, 0x00, 0x5F, 0x00, 0x0F, 0x08, 0x00, 0x05, 0x00, 0x00, 0x3C,
+  0x00, 0xB3, 0x00, 0xFE, 0x09, 0xFF, 0x00, 0xF7, 0x00, 0x96, 0x00, 0x18, 0x06, 0x00, 0x03, 0x00,
+  0x00, 0x07, 0x00, 0x96, 0x0E, 0xFF, 0x00, 0xEE, 0x00, 0x54, 0x05, 0x00, 0x02, 0x00, 0x00, 0x11,
+  0x00, 0xCD, 0x10, 0xFF, 0x00, 0xFE, 0x00, 0x72, 0x04, 0x00, 0x01, 0x00, 0x00, 0x06, 0x00, 0xC0,
+  0x13, 0xFF, 0x00, 0x5F, 0x03, 0x00, 0x01, 0x00, 0x00, 0x8F, 0x14, 0xFF, 0x00, 0xF3, 0x00, 0x1E,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0xF9, 0x06, 0xFF, 0x00, 0xFE, 0x00, 0x98, 0x00, 0x33,
+  0x00, 0x0A, 0x00, 0x0D, 0x00, 0x3A, 0x00, 0xAA, 0x07, 0xFF, 0x00, 0xB3, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x9A, 0x07, 0xFF, 0x00, 0x6F, 0x05, 0x00, 0x00, 0x90, 0x07, 0xFF, 0x00, 0x46, 0x01, 0x00,
+  0x00, 0x01, 0x00, 0xE7, 0x06, 0xFF, 0x00, 0xD0, 0x00, 0x01, 0x05, 0x00, 0x00, 0x08, 0x00, 0xE8,
+  0x06, 0xFF, 0x00, 0xAA, 0x01, 0x00, 0x00, 0x30, 0x07, 0xFF, 0x00, 0x79, 0x07, 0x00, 0x00, 0x97,
+  0x06, 0xFF, 0x00, 0xF9, 0x00, 0x13, 0x00, 0x00, 0x00, 0x58, 0x07, 0xFF, 0x00, 0x4A, 0x07, 0x00,
+  0x00, 0x67, 0x07, 0xFF, 0x00, 0x65, 0x00, 0x00, 0x00, 0x6E, 0x07, 0xFF, 0x00, 0x36, 0x07, 0x00,
+  0x00, 0x53, 0x07, 0xFF, 0x00, 0x9B, 0x00, 0x00, 0x00, 0x7E, 0x07, 0xFF, 0x00, 0x36, 0x07, 0x00,
+  0x00, 0x54, 0x07, 0xFF, 0x00, 0xCD, 0x00, 0x00, 0x00, 0x70, 0x07, 0xFF, 0x00, 0x49, 0x07, 0x00,
+  0x00, 0x67, 0x07, 0xFF, 0x00, 0xF9, 0x00, 0x06, 0x00, 0x5A, 0x07, 0xFF, 0x00, 0x79, 0x07, 0x00,
+  0x00, 0x96, 0x08, 0xFF, 0x00, 0x1F, 0x00, 0x2C, 0x07, 0xFF, 0x00, 0xCF, 0x06, 0x00, 0x00, 0x07,
+  0x00, 0xE7, 0x08, 0xFF, 0x00, 0x2E, 0x00, 0x00, 0x00, 0xE2, 0x07, 0xFF, 0x00, 0x6D, 0x05, 0x00,
+  0x00, 0x8C, 0x09, 0xFF, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x86, 0x07, 0xFF, 0x00, 0xFE, 0x00, 0x96,
+  0x00, 0x31, 0x00, 0x09, 0x00, 0x0B, 0x00, 0x38, 0x00, 0xA8, 0x0A, 0xFF, 0x00, 0x4B, 0x00, 0x00,
+  0x00, 0x11, 0x00, 0xEF, 0x18, 0xFF, 0x00, 0x4F, 0x01, 0x00, 0x00, 0x5C, 0x18, 0xFF, 0x00, 0x47,
+  0x02, 0x00, 0x00, 0x81, 0x17, 0xFF, 0x00, 0x39, 0x03, 0x00, 0x00, 0x67, 0x00, 0xF8, 0x0C, 0xFF,
+  0x00, 0xE1, 0x07, 0xFF, 0x00, 0x1F, 0x04, 0x00, 0x00, 0x2E, 0x00, 0xAF, 0x00, 0xFE, 0x08, 0xFF,
+  0x00, 0xE4, 0x00, 0x64, 0x00, 0x62, 0x06, 0xFF, 0x00, 0xFA, 0x00, 0x05, 0x06, 0x00, 0x00, 0x27,
+  0x00, 0x72, 0x00, 0xB4, 0x00, 0xDA, 0x00, 0xEE, 0x00, 0xFB, 0x00, 0xEC, 0x00, 0xD3, 0x00, 0x9B,
+  0x00, 0x53, 0x00, 0x04, 0x00, 0x00, 0x00, 0x86, 0x06, 0xFF, 0x00, 0xD2, 0x00, 0x00, 0x12, 0x00,
+  0x00, 0xC4, 0x06, 0xFF, 0x00, 0x9C, 0x00, 0x00, 0x11, 0x00, 0x00, 0x13, 0x00, 0xFC, 0x06, 0xFF,
+  0x00, 0x58, 0x00, 0x00, 0x11, 0x00, 0x00, 0x7E, 0x06, 0xFF, 0x00, 0xF7, 0x00, 0x0F, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x1B, 0x00, 0xEE, 0x06, 0xFF, 0x00, 0xA5, 0x01, 0x00, 0x0F, 0x00, 0x00, 0x0B,
+  0x00, 0xC5, 0x07, 0xFF, 0x00, 0x30, 0x01, 0x00, 0x01, 0x00, 0x00, 0x2E, 0x00, 0xB6, 0x00, 0x4C,
+  0x00, 0x04, 0x08, 0x00, 0x00, 0x27, 0x00, 0xCE, 0x07, 0xFF, 0x00, 0xA8, 0x02, 0x00, 0x01, 0x00,
+  0x00, 0x30, 0x01, 0xFF, 0x00, 0xED, 0x00, 0xA2, 0x00, 0x63, 0x00, 0x33, 0x00, 0x15, 0x00, 0x05,
+  0x00, 0x0C, 0x00, 0x21, 0x00, 0x58, 0x00, 0xA6, 0x00, 0xFC, 0x07, 0xFF, 0x00, 0xEE, 0x00, 0x19,
+  0x02, 0x00, 0x01, 0x00, 0x00, 0x30, 0x13, 0xFF, 0x00, 0xFE, 0x00, 0x4B, 0x03, 0x00, 0x01, 0x00,
+  0x00, 0x30, 0x13, 0xFF, 0x00, 0x69, 0x04, 0x00, 0x01, 0x00, 0x00, 0x30, 0x11, 0xFF, 0x00, 0xF8,
+  0x00, 0x5F, 0x05, 0x00, 0x01, 0x00, 0x00, 0x30, 0x10, 0xFF, 0x00, 0xD1, 0x00, 0x33, 0x06, 0x00,
+  0x01, 0x00, 0x00, 0x01, 0x00, 0x47, 0x00, 0xAD, 0x00, 0xF9, 0x0B, 0xFF, 0x00, 0xD2, 0x00, 0x5F,
+  0x00, 0x04, 0x07, 0x00, 0x04, 0x00, 0x00, 0x0B, 0x00, 0x4D, 0x00, 0x8B, 0x00, 0xB6, 0x00, 0xDC,
+  0x00, 0xED, 0x01, 0xFA, 0x00, 0xEE, 0x00, 0xD4, 0x00, 0xAE, 0x00, 0x75, 0x00, 0x2E, 0x0A, 0x00,
+  /* code 003A */
+  0x00, 0xA0, 0x06, 0xFF, 0x00, 0xD4, 0x00, 0xA0, 0x06, 0xFF, 0x00, 0xD4, 0x00, 0xA0, 0x06, 0xFF,
+  0x00, 0xD4, 0x00, 0xA0, 0x06, 0xFF, 0x00, 0xD4, 0x00, 0xA0, 0x06, 0xFF, 0x00, 0xD4, 0x00, 0xA0,
+  0x06, 0xFF, 0x00, 0xD4, 0x00, 0xA0, 0x06, 0xFF, 0x00, 0xD4, 0x00, 0xA0, 0x06, 0xFF, 0x00, 0xD4,
+  0x00, 0xA0, 0x06, 0xFF, 0x00, 0xD4, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00,
+  0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0xA0, 0x06, 0xFF, 0x00, 0xD4, 0x00, 0xA0, 0x06, 0xFF,
+  0x00, 0xD4, 0x00, 0xA0, 0x06, 0xFF, 0x00, 0xD4, 0x00, 0xA0, 0x06, 0xFF, 0x00, 0xD4, 0x00, 0xA0,
+  0x06, 0xFF, 0x00, 0xD4, 0x00, 0xA0, 0x06, 0xFF, 0x00, 0xD4, 0x00, 0xA0, 0x06, 0xFF, 0x00, 0xD4,
+  0x00, 0xA0, 0x06, 0xFF, 0x00, 0xD4, 0x00, 0xA0, 0x06, 0xFF, 0x00, 0xD4
+};
+
+static const charinfo_rle_type DejaVu_num_33x43_aa8_rle_charinfo3[16] = {
+   {  31,  30,    5,    6,  40, 0,     0U } /* code 002B */
+  ,{  12,  16,    2,   27,  18, 0,   276U } /* code 002C */
+  ,{  16,   7,    2,   19,  20, 0,   432U } /* code 002D */
+  ,{  10,   9,    4,   27,  18, 0,   474U } /* code 002E */
+  ,{  18,  39,    0,    1,  18, 0,   528U } /* code 002F */
+  ,{  30,  37,    2,    0,  33, 0,   940U } /* code 0030 */
+  ,{  26,  35,    5,    1,  33, 0,  1598U } /* code 0031 */
+  ,{  27,  36,    3,    0,  33, 0,  1950U } /* code 0032 */
+  ,{  27,  37,    3,    0,  33, 0,  2406U } /* code 0033 */
+  ,{  30,  35,    2,    1,  33, 0,  2964U } /* code 0034 */
+  ,{  28,  36,    3,    1,  33, 0,  3436U } /* code 0035 */
+  ,{  29,  37,    2,    0,  33, 0,  3944U } /* code 0036 */
+  ,{  27,  35,    3,    1,  33, 0,  4590U } /* code 0037 */
+  ,{  29,  37,    2,    0,  33, 0,  4954U } /* code 0038 */
+  ,{  29,  37,    2,    0,  33, 0,  5636U } /* code 0039 */
+  ,{   9,  26,    5,   10,  19, 0,  6260U } /* code 003A */
+};
+
+static const prop_rle_type DejaVu_num_33x43_aa8_rle_prop3 = {
+   0x002BU                                 // first character
+  ,0x003AU                                 // last character
+  ,DejaVu_num_33x43_aa8_rle_charinfo3      // char info of the range
+  ,DejaVu_num_33x43_aa8_rle_data3          // RLE streams of the range
+  ,nullptr                                 // pointer to next range
+};
+
+static const prop_rle_type DejaVu_num_33x43_aa8_rle_prop2 = {
+   0x0025U                                 // first character
+  ,0x0025U                                 // last character
+  ,DejaVu_num_33x43_aa8_rle_charinfo2      // char info of the range
+  ,DejaVu_num_33x43_aa8_rle_data2          // RLE streams of the range
+  ,&DejaVu_num_33x43_aa8_rle_prop3         // pointer to next range
+};
+
+static const prop_rle_type DejaVu_num_33x43_aa8_rle_prop1 = {
+   0x0020U                                 // first character
+  ,0x0020U                                 // last character
+  ,DejaVu_num_33x43_aa8_rle_charinfo1      // char info of the range
+  ,nullptr                                 // RLE streams of the range
+  ,&DejaVu_num_33x43_aa8_rle_prop2         // pointer to next range
+};
+
+const font_type DejaVu_num_33x43_aa8_rle = {
+   ENCODING_UNICODE | AA_8 | TYPE_PROP | FORMAT_RLE  // type of font
+  ,43U                                     // height of font
+  ,43U                                     // y space of font
+  ,36U                                     // baseline
+  ,&DejaVu_num_33x43_aa8_rle_prop1         // font data
+};
+
+} // namespace font
+} // namespace vic
@@ -0,0 +1,521 @@
+///////////////////////////////////////////////////////////////////////////////
+// \author (c) Marco Paland (info@paland.com)
+//             2017-2017, PALANDesign Hannover, Germany
+//
+// \license The MIT License (MIT)
+//
+// This file is part of the vic library.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// \brief Compile time pixel format traits and span/blit/conversion kernels
+// Every format is described by a pixel_format<> specialization, the kernels are
+// instantiated per format, so there's no per pixel format branching at runtime.
+//
+// Memory layout of pixel data:
+// Formats with less than 8 bpp are packed, the leftmost pixel is stored in the
+// least significant bits of a byte (XBM order).
+// Formats with 8 bpp and more are stored byte aligned, MSB first (display transfer order).
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _VIC_FORMAT_H_
+#define _VIC_FORMAT_H_
+
+#include <cstdint>
+#include <cstddef>
+
+#include "color.h"
+
+
+namespace vic {
+namespace color {
+
+
+/**
+ * Pixel format traits
+ * head_type: Native (head) color type
+ * bpp:       Storage bits per pixel
+ * depth:     Color depth in bits
+ * xxx_mask:  Channel masks within the native color
+ * pack:      Convert internal ARGB color to native head color
+ * unpack:    Convert native head color to internal ARGB color
+ */
+template<format_type Format>
+struct pixel_format;
+
+
+template<>
+struct pixel_format<format_L1>
+{
+  typedef std::uint8_t head_type;
+  static constexpr std::uint8_t  bpp        = 1U;
+  static constexpr std::uint8_t  depth      = 1U;
+  static constexpr std::uint32_t alpha_mask = 0x00U;
+  static constexpr std::uint32_t red_mask   = 0x01U;
+  static constexpr std::uint32_t green_mask = 0x01U;
+  static constexpr std::uint32_t blue_mask  = 0x01U;
+
+  static inline head_type pack(value_type color)
+  { return static_cast<head_type>((color & 0x00FFFFFFUL) != 0UL ? 1U : 0U); }
+
+  static inline value_type unpack(head_type head_color)
+  { return (head_color & 0x01U) ? white : black; }
+};
+
+
+template<>
+struct pixel_format<format_L2>
+{
+  typedef std::uint8_t head_type;
+  static constexpr std::uint8_t  bpp        = 2U;
+  static constexpr std::uint8_t  depth      = 2U;
+  static constexpr std::uint32_t alpha_mask = 0x00U;
+  static constexpr std::uint32_t red_mask   = 0x03U;
+  static constexpr std::uint32_t green_mask = 0x03U;
+  static constexpr std::uint32_t blue_mask  = 0x03U;
+
+  static inline head_type pack(value_type color)
+  { return static_cast<head_type>(((std::uint16_t)((std::uint16_t)get_red(color) + (std::uint16_t)get_green(color) + (std::uint16_t)get_blue(color)) / 3U) >> 6U); }
+
+  static inline value_type unpack(head_type head_color)
+  { return dim(white, static_cast<std::uint8_t>(255U / 3U * (head_color & 0x03U))); }
+};
+
+
+template<>
+struct pixel_format<format_L4>
+{
+  typedef std::uint8_t head_type;
+  static constexpr std::uint8_t  bpp        = 4U;
+  static constexpr std::uint8_t  depth      = 4U;
+  static constexpr std::uint32_t alpha_mask = 0x00U;
+  static constexpr std::uint32_t red_mask   = 0x0FU;
+  static constexpr std::uint32_t green_mask = 0x0FU;
+  static constexpr std::uint32_t blue_mask  = 0x0FU;
+
+  static inline head_type pack(value_type color)
+  { return static_cast<head_type>(((std::uint16_t)((std::uint16_t)get_red(color) + (std::uint16_t)get_green(color) + (std::uint16_t)get_blue(color)) / 3U) >> 4U); }
+
+  static inline value_type unpack(head_type head_color)
+  { return dim(white, static_cast<std::uint8_t>(255U / 15U * (head_color & 0x0FU))); }
+};
+
+
+template<>
+struct pixel_format<format_L8>
+{
+  typedef std::uint8_t head_type;
+  static constexpr std::uint8_t  bpp        = 8U;
+  static constexpr std::uint8_t  depth      = 8U;
+  static constexpr std::uint32_t alpha_mask = 0x00U;
+  static constexpr std::uint32_t red_mask   = 0xFFU;
+  static constexpr std::uint32_t green_mask = 0xFFU;
+  static constexpr std::uint32_t blue_mask  = 0xFFU;
+
+  static inline head_type pack(value_type color)
+  { return static_cast<head_type>((std::uint16_t)((std::uint16_t)get_red(color) + (std::uint16_t)get_green(color) + (std::uint16_t)get_blue(color)) / 3U); }
+
+  static inline value_type unpack(head_type head_color)
+  { return dim(white, head_color); }
+};
+
+
+template<>
+struct pixel_format<format_RGB332>
+{
+  typedef std::uint8_t head_type;
+  static constexpr std::uint8_t  bpp        = 8U;
+  static constexpr std::uint8_t  depth      = 8U;
+  static constexpr std::uint32_t alpha_mask = 0x00U;
+  static constexpr std::uint32_t red_mask   = 0xE0U;
+  static constexpr std::uint32_t green_mask = 0x1CU;
+  static constexpr std::uint32_t blue_mask  = 0x03U;
+
+  static inline head_type pack(value_type color)
+  { return static_cast<head_type>((std::uint8_t)(get_red(color) & 0xE0U) | (std::uint8_t)((get_green(color) & 0xE0U) >> 3U) | (std::uint8_t)((get_blue(color)) >> 6U)); }
+
+  static inline value_type unpack(head_type head_color)
+  { return argb(static_cast<std::uint8_t>(head_color & 0xE0U), static_cast<std::uint8_t>((head_color & 0x1CU) << 3U), static_cast<std::uint8_t>((head_color & 0x03U) << 6U)); }
+};
+
+
+template<>
+struct pixel_format<format_RGB444>
+{
+  typedef std::uint16_t head_type;
+  static constexpr std::uint8_t  bpp        = 16U;
+  static constexpr std::uint8_t  depth      = 12U;
+  static constexpr std::uint32_t alpha_mask = 0x0000U;
+  static constexpr std::uint32_t red_mask   = 0x0F00U;
+  static constexpr std::uint32_t green_mask = 0x00F0U;
+  static constexpr std::uint32_t blue_mask  = 0x000FU;
+
+  static inline head_type pack(value_type color)
+  { return static_cast<head_type>(((std::uint16_t)(get_red(color) & 0xF0U) << 4U) | ((std::uint16_t)(get_green(color) & 0xF0U)) | (std::uint16_t)(get_blue(color) >> 4U)); }
+
+  static inline value_type unpack(head_type head_color)
+  { return argb(static_cast<std::uint8_t>((head_color & 0x0F00U) >> 4U), static_cast<std::uint8_t>((head_color & 0x00F0U)), static_cast<std::uint8_t>((head_color & 0x000FU) << 4U)); }
+};
+
+
+template<>
+struct pixel_format<format_RGB555>
+{
+  typedef std::uint16_t head_type;
+  static constexpr std::uint8_t  bpp        = 16U;
+  static constexpr std::uint8_t  depth      = 15U;
+  static constexpr std::uint32_t alpha_mask = 0x0000U;
+  static constexpr std::uint32_t red_mask   = 0x7C00U;
+  static constexpr std::uint32_t green_mask = 0x03E0U;
+  static constexpr std::uint32_t blue_mask  = 0x001FU;
+
+  static inline head_type pack(value_type color)
+  { return static_cast<head_type>(((std::uint16_t)(get_red(color) & 0xF8U) << 7U) | ((std::uint16_t)(get_green(color) & 0xF8U) << 2U) | (std::uint16_t)(get_blue(color) >> 3U)); }
+
+  static inline value_type unpack(head_type head_color)
+  { return argb(static_cast<std::uint8_t>((head_color & 0x7C00U) >> 7U), static_cast<std::uint8_t>((head_color & 0x03E0U) >> 2U), static_cast<std::uint8_t>((head_color & 0x001FU) << 3U)); }
+};
+
+
+template<>
+struct pixel_format<format_RGB565>
+{
+  typedef std::uint16_t head_type;
+  static constexpr std::uint8_t  bpp        = 16U;
+  static constexpr std::uint8_t  depth      = 16U;
+  static constexpr std::uint32_t alpha_mask = 0x0000U;
+  static constexpr std::uint32_t red_mask   = 0xF800U;
+  static constexpr std::uint32_t green_mask = 0x07E0U;
+  static constexpr std::uint32_t blue_mask  = 0x001FU;
+
+  static inline head_type pack(value_type color)
+  { return static_cast<head_type>(((std::uint16_t)(get_red(color) & 0xF8U) << 8U) | ((std::uint16_t)(get_green(color) & 0xFCU) << 3U) | (std::uint16_t)(get_blue(color) >> 3U)); }
+
+  static inline value_type unpack(head_type head_color)
+  { return argb(static_cast<std::uint8_t>((head_color & 0xF800U) >> 8U), static_cast<std::uint8_t>((head_color & 0x07E0U) >> 3U), static_cast<std::uint8_t>((head_color & 0x001FU) << 3U)); }
+};
+
+
+template<>
+struct pixel_format<format_RGB666>
+{
+  typedef std::uint32_t head_type;
+  static constexpr std::uint8_t  bpp        = 24U;
+  static constexpr std::uint8_t  depth      = 18U;
+  static constexpr std::uint32_t alpha_mask = 0x00000000UL;
+  static constexpr std::uint32_t red_mask   = 0x0003F000UL;
+  static constexpr std::uint32_t green_mask = 0x00000FC0UL;
+  static constexpr std::uint32_t blue_mask  = 0x0000003FUL;
+
+  static inline head_type pack(value_type color)
+  { return static_cast<head_type>(((std::uint32_t)(get_red(color) & 0xFCU) << 10U) | ((std::uint32_t)(get_green(color) & 0xFCU) << 4U) | (std::uint32_t)(get_blue(color) >> 2U)); }
+
+  static inline value_type unpack(head_type head_color)
+  { return argb(static_cast<std::uint8_t>((head_color & 0x0003F000UL) >> 10U), static_cast<std::uint8_t>((head_color & 0x00000FC0UL) >> 4U), static_cast<std::uint8_t>((head_color & 0x0000003FUL) << 2U)); }
+};
+
+
+template<>
+struct pixel_format<format_RGB888>
+{
+  typedef std::uint32_t head_type;
+  static constexpr std::uint8_t  bpp        = 24U;
+  static constexpr std::uint8_t  depth      = 24U;
+  static constexpr std::uint32_t alpha_mask = 0x00000000UL;
+  static constexpr std::uint32_t red_mask   = 0x00FF0000UL;
+  static constexpr std::uint32_t green_mask = 0x0000FF00UL;
+  static constexpr std::uint32_t blue_mask  = 0x000000FFUL;
+
+  static inline head_type pack(value_type color)
+  { return static_cast<head_type>(color & 0x00FFFFFFUL); }
+
+  static inline value_type unpack(head_type head_color)
+  { return static_cast<value_type>(head_color & 0x00FFFFFFUL) | 0xFF000000UL; }
+};
+
+
+template<>
+struct pixel_format<format_ARGB8888>
+{
+  typedef std::uint32_t head_type;
+  static constexpr std::uint8_t  bpp        = 32U;
+  static constexpr std::uint8_t  depth      = 32U;
+  static constexpr std::uint32_t alpha_mask = 0xFF000000UL;
+  static constexpr std::uint32_t red_mask   = 0x00FF0000UL;
+  static constexpr std::uint32_t green_mask = 0x0000FF00UL;
+  static constexpr std::uint32_t blue_mask  = 0x000000FFUL;
+
+  static inline head_type pack(value_type color)
+  { return color; }
+
+  static inline value_type unpack(head_type head_color)
+  { return head_color; }
+};
+
+
+//////////////////////////////////////////////////////////////////////////
+// P I X E L   K E R N E L S
+
+/**
+ * Span kernels to read, write and fill pixels of the given format in a memory row
+ * \param Format Pixel format
+ * \param Packed True for formats with less than 8 bpp (selected automatically)
+ */
+template<format_type Format, bool Packed = (pixel_format<Format>::bpp < 8U)>
+struct pixel_kernel;
+
+
+// packed formats (1, 2 and 4 bpp)
+template<format_type Format>
+struct pixel_kernel<Format, true>
+{
+  typedef pixel_format<Format>           traits;
+  typedef typename traits::head_type     head_type;
+  static constexpr std::uint8_t ppb    = 8U / traits::bpp;                  // pixels per byte
+  static constexpr std::uint8_t mask   = (1U << traits::bpp) - 1U;          // pixel mask
+
+  /**
+   * Return the number of bytes a row of the given width takes
+   * \param width Row width in pixel
+   */
+  static inline std::size_t stride(std::uint16_t width)
+  { return (static_cast<std::size_t>(width) * traits::bpp + 7U) / 8U; }
+
+  static inline head_type read(const std::uint8_t* row, std::uint16_t x)
+  { return static_cast<head_type>((row[x / ppb] >> ((x % ppb) * traits::bpp)) & mask); }
+
+  static inline void write(std::uint8_t* row, std::uint16_t x, head_type value)
+  {
+    const std::uint8_t shift = static_cast<std::uint8_t>((x % ppb) * traits::bpp);
+    row[x / ppb] = static_cast<std::uint8_t>((row[x / ppb] & ~(mask << shift)) | ((value & mask) << shift));
+  }
+
+  /**
+   * Fill a span with the given native color
+   * Partial bytes at the span borders are masked, all inner bytes are written as a whole
+   */
+  static inline void fill(std::uint8_t* row, std::uint16_t x, std::uint16_t length, head_type value)
+  {
+    // replicate the pixel over the whole byte
+    std::uint8_t pattern = static_cast<std::uint8_t>(value & mask);
+    for (std::uint8_t n = traits::bpp; n < 8U; n = static_cast<std::uint8_t>(n * 2U)) {
+      pattern = static_cast<std::uint8_t>(pattern | (pattern << n));
+    }
+    // leading partial byte
+    for (; length && (x % ppb); --length, ++x) {
+      write(row, x, value);
+    }
+    // full bytes
+    std::uint8_t* p = &row[x / ppb];
+    for (; length >= ppb; length = static_cast<std::uint16_t>(length - ppb), x = static_cast<std::uint16_t>(x + ppb)) {
+      *p++ = pattern;
+    }
+    // trailing partial byte
+    for (; length; --length, ++x) {
+      write(row, x, value);
+    }
+  }
+};
+
+
+// byte aligned formats (8, 16, 24 and 32 bpp), stored MSB first
+template<format_type Format>
+struct pixel_kernel<Format, false>
+{
+  typedef pixel_format<Format>           traits;
+  typedef typename traits::head_type     head_type;
+  static constexpr std::uint8_t bytes  = traits::bpp / 8U;                  // bytes per pixel
+
+  static inline std::size_t stride(std::uint16_t width)
+  { return static_cast<std::size_t>(width) * bytes; }
+
+  static inline head_type read(const std::uint8_t* row, std::uint16_t x)
+  {
+    const std::uint8_t* p = &row[static_cast<std::size_t>(x) * bytes];
+    std::uint32_t value = 0U;
+    for (std::uint8_t n = 0U; n < bytes; ++n) {
+      value = (value << 8U) | p[n];
+    }
+    return static_cast<head_type>(value);
+  }
+
+  static inline void write(std::uint8_t* row, std::uint16_t x, head_type value)
+  {
+    std::uint8_t* p = &row[static_cast<std::size_t>(x) * bytes];
+    for (std::uint8_t n = bytes; n > 0U; --n) {
+      p[n - 1U] = static_cast<std::uint8_t>(value);
+      value = static_cast<head_type>(static_cast<std::uint32_t>(value) >> 8U);
+    }
+  }
+
+  /**
+   * Fill a span with the given native color
+   * The first pixel is written, then the row is filled by doubling the already written pattern
+   */
+  static inline void fill(std::uint8_t* row, std::uint16_t x, std::uint16_t length, head_type value)
+  {
+    if (!length) {
+      return;
+    }
+    std::uint8_t* p = &row[static_cast<std::size_t>(x) * bytes];
+    write(p, 0U, value);
+    const std::size_t size = static_cast<std::size_t>(length) * bytes;
+    for (std::size_t done = bytes; done < size; ) {
+      const std::size_t n = (done <= size - done) ? done : size - done;
+      for (std::size_t i = 0U; i < n; ++i) {
+        p[done + i] = p[i];
+      }
+      done += n;
+    }
+  }
+};
+
+
+/**
+ * Convert a span of pixels from native format to internal ARGB format
+ * \param dst Destination ARGB color array
+ * \param src Source row
+ * \param src_x Pixel index of the first source pixel in the row
+ * \param length Pixel count
+ */
+template<format_type Src>
+inline void span_to_argb(value_type* dst, const std::uint8_t* src, std::uint16_t src_x, std::uint16_t length)
+{
+  for (; length; --length) {
+    *dst++ = pixel_format<Src>::unpack(pixel_kernel<Src>::read(src, src_x++));
+  }
+}
+
+
+/**
+ * Convert a span of pixels from internal ARGB format to native format
+ * \param dst Destination row
+ * \param dst_x Pixel index of the first destination pixel in the row
+ * \param src Source ARGB color array
+ * \param length Pixel count
+ */
+template<format_type Dst>
+inline void span_from_argb(std::uint8_t* dst, std::uint16_t dst_x, const value_type* src, std::uint16_t length)
+{
+  for (; length; --length) {
+    pixel_kernel<Dst>::write(dst, dst_x++, pixel_format<Dst>::pack(*src++));
+  }
+}
+
+
+/**
+ * Span conversion kernel, converts a span from source format to destination format
+ * Identical formats are copied without conversion
+ */
+template<format_type Src, format_type Dst>
+struct span_converter
+{
+  static inline void convert(std::uint8_t* dst, std::uint16_t dst_x, const std::uint8_t* src, std::uint16_t src_x, std::uint16_t length)
+  {
+    for (; length; --length) {
+      pixel_kernel<Dst>::write(dst, dst_x++, pixel_format<Dst>::pack(pixel_format<Src>::unpack(pixel_kernel<Src>::read(src, src_x++))));
+    }
+  }
+};
+
+
+template<format_type Format>
+struct span_converter<Format, Format>
+{
+  static inline void convert(std::uint8_t* dst, std::uint16_t dst_x, const std::uint8_t* src, std::uint16_t src_x, std::uint16_t length)
+  {
+    if (pixel_format<Format>::bpp >= 8U) {
+      // byte aligned, plain copy
+      const std::size_t bytes = pixel_format<Format>::bpp / 8U;
+      std::uint8_t*       d = &dst[static_cast<std::size_t>(dst_x) * bytes];
+      const std::uint8_t* s = &src[static_cast<std::size_t>(src_x) * bytes];
+      for (std::size_t n = static_cast<std::size_t>(length) * bytes; n; --n) {
+        *d++ = *s++;
+      }
+    }
+    else {
+      for (; length; --length) {
+        pixel_kernel<Format>::write(dst, dst_x++, pixel_kernel<Format>::read(src, src_x++));
+      }
+    }
+  }
+};
+
+
+/**
+ * Convert a span from source format to destination format
+ * \param dst Destination row
+ * \param dst_x Pixel index of the first destination pixel in the row
+ * \param src Source row
+ * \param src_x Pixel index of the first source pixel in the row
+ * \param length Pixel count
+ */
+template<format_type Src, format_type Dst>
+inline void span_convert(std::uint8_t* dst, std::uint16_t dst_x, const std::uint8_t* src, std::uint16_t src_x, std::uint16_t length)
+{
+  span_converter<Src, Dst>::convert(dst, dst_x, src, src_x, length);
+}
+
+
+/**
+ * Fill a span with the given ARGB color, the color is packed only once
+ * \param dst Destination row
+ * \param dst_x Pixel index of the first destination pixel in the row
+ * \param length Pixel count
+ * \param color Fill color in ARGB format
+ */
+template<format_type Dst>
+inline void span_fill(std::uint8_t* dst, std::uint16_t dst_x, std::uint16_t length, value_type color)
+{
+  pixel_kernel<Dst>::fill(dst, dst_x, length, pixel_format<Dst>::pack(color));
+}
+
+
+/**
+ * Dispatch a runtime format to a format templated visitor, the format switch is done once
+ * The visitor must provide a 'template<format_type Format> void apply()' member function
+ * \param format Color format
+ * \param visitor Visitor which is called with the format as template argument
+ * \return true if the format is supported
+ */
+template<class Visitor>
+inline bool format_dispatch(format_type format, Visitor& visitor)
+{
+  switch (format) {
+    case format_L1       : visitor.template apply<format_L1>();       return true;
+    case format_L2       : visitor.template apply<format_L2>();       return true;
+    case format_L4       : visitor.template apply<format_L4>();       return true;
+    case format_L8       : visitor.template apply<format_L8>();       return true;
+    case format_RGB332   : visitor.template apply<format_RGB332>();   return true;
+    case format_RGB444   : visitor.template apply<format_RGB444>();   return true;
+    case format_RGB555   : visitor.template apply<format_RGB555>();   return true;
+    case format_RGB565   : visitor.template apply<format_RGB565>();   return true;
+    case format_RGB666   : visitor.template apply<format_RGB666>();   return true;
+    case format_RGB888   : visitor.template apply<format_RGB888>();   return true;
+    case format_ARGB8888 : visitor.template apply<format_ARGB8888>(); return true;
+    default :
+      // unsupported format
+      return false;
+  }
+}
+
+} // namespace color
+} // namespace vic
+
+#endif  // _VIC_FORMAT_H_
@@ -0,0 +1,285 @@
+///////////////////////////////////////////////////////////////////////////////
+// \author (c) Marco Paland (info@paland.com)
+//             2017-2017, PALANDesign Hannover, Germany
+//
+// \license The MIT License (MIT)
+//
+// This file is part of the vic library.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// \brief LRU glyph cache
+// The cache holds rendered glyphs as ARGB pixels (pen color and coverage applied) or
+// opaque text cells (foreground/background blended) in a caller provided memory arena,
+// so redrawing the same chars in the same colors doesn't decode the packed font data again.
+// The glyphs are held in ARGB and not in the pixel format of the head, because the text
+// renderer has no access to the head format: a cache hit is passed as ARGB spans, which
+// the head converts in its span functions, like every other blit.
+// Glyphs are found by a hash index, the LRU slot is only searched on a cache miss.
+//
+// Usage:
+// static std::uint32_t _arena[1024];                                 // 4k arena
+// vic::glyph_cache _cache(_arena, sizeof(_arena), 16U * 24U);        // slots for 16x24 glyphs
+// _head.text_cache_set(&_cache);
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _VIC_GLYPH_CACHE_H_
+#define _VIC_GLYPH_CACHE_H_
+
+#include <cstdint>
+#include <cstddef>
+
+#include "color.h"
+#include "font.h"
+
+
+namespace vic {
+
+
+/**
+ * Fixed size LRU glyph cache
+ * The arena is split into equal slots of slot_pixels ARGB pixels plus the slot header and
+ * the hash buckets, glyphs which are larger than a slot are not cached.
+ */
+class glyph_cache
+{
+public:
+
+  /**
+   * Cache key
+   */
+  typedef struct tag_key_type {
+    const font::font_type*  font;       // font of the glyph, nullptr = slot unused
+    std::uint32_t           ch;         // char code
+    color::value_type       color;      // pen (foreground) color the glyph is rendered with
+    color::value_type       background; // background color of opaque cells
+    bool                    opaque;     // true if the entry is an opaque cell (all pixels set)
+    std::int16_t            angle;      // rotation of the glyph in degree
+    std::uint8_t            subpixel;   // stripe order a subpixel glyph is filtered for, 0 = grayscale
+
+    inline bool operator==(const tag_key_type& rhs) const {
+      return (font == rhs.font) && (ch == rhs.ch) && (color == rhs.color) &&
+             (opaque == rhs.opaque) && (!opaque || (background == rhs.background)) && (angle == rhs.angle) && (subpixel == rhs.subpixel);
+    }
+  } key_type;
+
+
+  /**
+   * Cache entry (slot header)
+   */
+  typedef struct tag_entry_type {
+    key_type                key;        // cache key
+    std::uint8_t            width;      // glyph width in pixel
+    std::uint8_t            height;     // glyph height in pixel
+    std::uint32_t           stamp;      // last access (LRU)
+    std::uint16_t           next;       // next entry of the hash bucket, NONE = end of chain
+    color::value_type*      data;       // glyph pixels, row by row, 0 = not covered (transparent glyphs)
+  } entry_type;
+
+
+  /**
+   * ctor
+   * \param arena Memory arena for the cache, must stay valid for the lifetime of the cache
+   * \param arena_size Size of the arena in bytes
+   * \param slot_pixels Max. pixel count (width * height) of a cached glyph
+   */
+  glyph_cache(void* arena, std::size_t arena_size, std::uint16_t slot_pixels)
+    : entry_(nullptr)
+    , bucket_(nullptr)
+    , entry_count_(0U)
+    , bucket_mask_(0U)
+    , stamp_(0U)
+    , hits_(0U)
+    , misses_(0U)
+    , slot_pixels_(slot_pixels)
+  {
+    // align the arena to the entry/pixel type
+    const std::size_t align = sizeof(void*) > sizeof(color::value_type) ? sizeof(void*) : sizeof(color::value_type);
+    const std::size_t skew  = reinterpret_cast<std::uintptr_t>(arena) % align;
+    const std::size_t skip  = skew ? align - skew : 0U;
+    if (!arena || !slot_pixels || (arena_size <= skip)) {
+      return;
+    }
+    arena_size -= skip;
+    std::uint8_t* mem = static_cast<std::uint8_t*>(arena) + skip;
+
+    // every slot takes one bucket at most, the bucket count is a power of 2 (load factor 1 to 2)
+    const std::size_t slot_size = sizeof(entry_type) + slot_pixels * sizeof(color::value_type) + sizeof(std::uint16_t);
+    if (arena_size <= align) {
+      return;
+    }
+    std::size_t count = (arena_size - align) / slot_size;
+    count = count < NONE ? count : NONE - 1U;
+    if (!count) {
+      return;
+    }
+    std::size_t buckets = 1U;
+    while (buckets * 2U <= count) {
+      buckets *= 2U;
+    }
+    const std::size_t bucket_size = ((buckets * sizeof(std::uint16_t) + align - 1U) / align) * align;
+
+    entry_count_ = static_cast<std::uint16_t>(count);
+    bucket_mask_ = static_cast<std::uint16_t>(buckets - 1U);
+    entry_       = reinterpret_cast<entry_type*>(mem);
+    bucket_      = reinterpret_cast<std::uint16_t*>(mem + entry_count_ * sizeof(entry_type));
+    color::value_type* pixels = reinterpret_cast<color::value_type*>(mem + entry_count_ * sizeof(entry_type) + bucket_size);
+    for (std::uint16_t i = 0U; i < entry_count_; ++i) {
+      entry_[i].data = pixels + i * slot_pixels;
+    }
+    clear();
+  }
+
+
+  /**
+   * Find a cached glyph, a hit marks the glyph as most recently used
+   * \param key Key of the glyph
+   * \return Cache entry, nullptr on a cache miss
+   */
+  const entry_type* find(const key_type& key)
+  {
+    if (entry_count_) {
+      for (std::uint16_t i = bucket_[hash(key)]; i != NONE; i = entry_[i].next) {
+        entry_type& e = entry_[i];
+        if (e.key == key) {
+          e.stamp = ++stamp_;
+          ++hits_;
+          return &e;
+        }
+      }
+    }
+    ++misses_;
+    return nullptr;
+  }
+
+
+  /**
+   * Allocate a slot for a new glyph, the least recently used glyph is evicted
+   * The caller renders the glyph into the data of the returned entry
+   * \param key Key of the glyph
+   * \param width Glyph width in pixel
+   * \param height Glyph height in pixel
+   * \return Cache entry, nullptr if the glyph doesn't fit into a slot
+   */
+  entry_type* insert(const key_type& key, std::uint16_t width, std::uint16_t height)
+  {
+    if (!entry_count_ || (width > 0xFFU) || (height > 0xFFU) || (static_cast<std::uint32_t>(width * height) > slot_pixels_)) {
+      return nullptr;
+    }
+    std::uint16_t index = 0U;
+    for (std::uint16_t i = 0U; i < entry_count_; ++i) {
+      if (!entry_[i].key.font) {
+        // free slot
+        index = i;
+        break;
+      }
+      if (entry_[i].stamp < entry_[index].stamp) {
+        index = i;
+      }
+    }
+    entry_type* lru = &entry_[index];
+    if (lru->key.font) {
+      // evict the glyph, unlink it from its bucket
+      for (std::uint16_t* link = &bucket_[hash(lru->key)]; *link != NONE; link = &entry_[*link].next) {
+        if (*link == index) {
+          *link = lru->next;
+          break;
+        }
+      }
+    }
+    const std::uint16_t bucket = hash(key);
+    lru->key     = key;
+    lru->next    = bucket_[bucket];
+    bucket_[bucket] = index;
+    lru->width  = static_cast<std::uint8_t>(width);
+    lru->height = static_cast<std::uint8_t>(height);
+    lru->stamp  = ++stamp_;
+    return lru;
+  }
+
+
+  /**
+   * Invalidate all cached glyphs
+   */
+  void clear()
+  {
+    for (std::uint16_t i = 0U; i < entry_count_; ++i) {
+      entry_[i].key.font = nullptr;
+      entry_[i].next     = NONE;
+    }
+    for (std::uint32_t i = 0U; entry_count_ && (i <= bucket_mask_); ++i) {
+      bucket_[i] = NONE;
+    }
+  }
+
+
+  /**
+   * Cache statistics
+   * \return Count of cache hits/misses since creation or the last statistics_reset() call
+   */
+  inline std::uint32_t hits()   const { return hits_; }
+  inline std::uint32_t misses() const { return misses_; }
+
+  inline void statistics_reset()
+  {
+    hits_ = misses_ = 0U;
+  }
+
+
+  /**
+   * Returns the count of glyph slots
+   * \return Slot count of the arena
+   */
+  inline std::uint16_t slot_count() const
+  {
+    return entry_count_;
+  }
+
+
+private:
+
+  static const std::uint16_t NONE = 0xFFFFU;    // end of a bucket chain
+
+  // bucket of a key
+  inline std::uint16_t hash(const key_type& key) const
+  {
+    std::uint32_t h = static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(key.font) >> 2U);
+    h = (h ^ key.ch) * 0x9E3779B1UL;
+    h = (h ^ key.color) * 0x9E3779B1UL;
+    h = (h ^ (key.opaque ? key.background : 0U) ^ (static_cast<std::uint32_t>(static_cast<std::uint16_t>(key.angle)) << 8U) ^ key.subpixel) * 0x9E3779B1UL;
+    return static_cast<std::uint16_t>((h >> 16U) & bucket_mask_);
+  }
+
+  entry_type*     entry_;         // slot headers in the arena
+  std::uint16_t*  bucket_;        // hash buckets, first entry of the chain
+  std::uint16_t   entry_count_;   // slot count
+  std::uint16_t   bucket_mask_;   // bucket count - 1
+  std::uint32_t   stamp_;         // access counter
+  std::uint32_t   hits_;          // cache hits
+  std::uint32_t   misses_;        // cache misses
+  std::uint16_t   slot_pixels_;   // max. pixels per glyph
+
+  // non copyable
+  const glyph_cache& operator=(const glyph_cache& rhs)
+  { return rhs; }
+};
+
+} // namespace vic
+
+#endif  // _VIC_GLYPH_CACHE_H_
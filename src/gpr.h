@@ -33,6 +33,7 @@
 #define _VIC_GPR_H_
 
 #include "base.h"
+#include "format.h"
 
 
 namespace vic {
@@ -379,7 +380,8 @@ public:
       std::size_t i = 0U;
       for (std::int16_t y = center.y - pen_shape_->height / 2, ye = y + pen_shape_->height; y < ye; ++y) {
         for (std::int16_t x = center.x - pen_shape_->width / 2, xe = x + pen_shape_->width; x < xe; ++x, ++i) {
-          drv_pixel_set_color({ x, y }, pen_shape_->alpha[i] == 0U ? pen_shape_->color : color::mix(drv_pixel_get({ x, y }), pen_get_color({ x, y }), pen_shape_->alpha[i]));
+          // the shape alpha is the weight of the background, the gamma LUT corrects the pen weight
+          drv_pixel_set_color({ x, y }, pen_shape_->alpha[i] == 0U ? pen_shape_->color : color::mix(drv_pixel_get({ x, y }), pen_get_color({ x, y }), static_cast<std::uint8_t>(255U - gamma_alpha(static_cast<std::uint8_t>(255U - pen_shape_->alpha[i])))));
         }
       }
     }
@@ -514,6 +516,68 @@ public:
   }
 
 
+  /**
+   * Set a horizontal span of pixels in the given color, no present is called
+   * This is the basic fill kernel, the fallback sets pixel by pixel and should be overridden
+   * by a driver which can stream pixels (e.g. by auto incrementing the GRAM address)
+   * \param start Left vertex of the span
+   * \param length Span length in pixel
+   * \param color Color of the span
+   */
+  virtual void span_horz(vertex_type start, std::uint16_t length, color::value_type color)
+  {
+    for (; length; --length, ++start.x) {
+      drv_pixel_set_color(start, color);
+    }
+  }
+
+
+  /**
+   * Set a horizontal span of pixels out of a color array, no present is called
+   * This is the basic blit kernel, the fallback sets pixel by pixel and should be overridden
+   * by a driver which can stream pixels (e.g. by auto incrementing the GRAM address)
+   * \param start Left vertex of the span
+   * \param length Span length in pixel
+   * \param colors Array of 'length' colors in ARGB format
+   */
+  virtual void span_horz(vertex_type start, std::uint16_t length, const color::value_type* colors)
+  {
+    for (; length; --length, ++start.x) {
+      drv_pixel_set_color(start, *colors++);
+    }
+  }
+
+
+  /**
+   * Set a vertical span of pixels in the given color, no present is called
+   * The fallback sets pixel by pixel and should be overridden by a driver which can stream pixels
+   * \param start Top vertex of the span
+   * \param length Span length in pixel
+   * \param color Color of the span
+   */
+  virtual void span_vert(vertex_type start, std::uint16_t length, color::value_type color)
+  {
+    for (; length; --length, ++start.y) {
+      drv_pixel_set_color(start, color);
+    }
+  }
+
+
+  /**
+   * Set a vertical span of pixels out of a color array, no present is called
+   * The fallback sets pixel by pixel and should be overridden by a driver which can stream pixels
+   * \param start Top vertex of the span
+   * \param length Span length in pixel
+   * \param colors Array of 'length' colors in ARGB format
+   */
+  virtual void span_vert(vertex_type start, std::uint16_t length, const color::value_type* colors)
+  {
+    for (; length; --length, ++start.y) {
+      drv_pixel_set_color(start, *colors++);
+    }
+  }
+
+
   /**
    * Draw a horizontal line, width is one pixel, no pen style support
    * This is a slow fallback implementation which should be overridden by a high speed driver implementation
@@ -532,9 +596,7 @@ public:
       }
     }
     else {
-      for (; v0.x <= v1.x; ++v0.x) {
-        pixel_set(v0, pen_get_color());
-      }
+      span_horz(v0, static_cast<std::uint16_t>(v1.x - v0.x + 1), pen_get_color());
     }
     present();
   }
@@ -557,9 +619,7 @@ public:
       }
     }
     else {
-      for (; v0.y <= v1.y; ++v0.y) {
-        pixel_set(v0, pen_get_color());
-      }
+      span_vert(v0, static_cast<std::uint16_t>(v1.y - v0.y + 1), pen_get_color());
     }
     present();
   }
@@ -660,7 +720,7 @@ public:
     }
     present_lock();
     for (std::size_t n = 0U; n < vertex_count; ++n) {
-      line(vertexes[n], vertexes[vertex_count + 1U]);
+      line(vertexes[n], vertexes[n + 1U]);
     }
     present_lock(false);    // present
   }
@@ -1180,15 +1240,60 @@ public:
 
   /**
    * Bit block image transfer to the display area
-   * This is a slow fallback implementation which should be overridden by a high speed driver implementation
-   * \param top_left
-   * \param bottom_right
-   * \param color_format
-   * \param data
+   * The format is dispatched once, the rows are converted span wise and passed to span_horz()
+   * Rows are byte aligned, packed formats (< 8 bpp) store the leftmost pixel in the LSBs (XBM order),
+   * other formats are stored MSB first
+   * \param top_left Top/left vertex of the image
+   * \param bottom_right Bottom/right vertex of the image, included
+   * \param color_format Color format of the image data
+   * \param data Image data
    */
   virtual void blitter(vertex_type top_left, vertex_type bottom_right, color::format_type color_format, const void* data)
   {
-    (void)top_left; (void)bottom_right; (void)color_format; (void)data;
+    vertex_top_left(top_left, bottom_right);
+    blit_visitor visitor = { *this, top_left, bottom_right, static_cast<const std::uint8_t*>(data) };
+    color::format_dispatch(color_format, visitor);
+    present();
+  }
+
+
+protected:
+
+  // format visitor of the blitter
+  struct blit_visitor
+  {
+    gpr&                g;
+    vertex_type         top_left;
+    vertex_type         bottom_right;
+    const std::uint8_t* data;
+
+    template<color::format_type Format>
+    inline void apply() { g.blit<Format>(top_left, bottom_right, data); }
+  };
+
+  /**
+   * Blit kernel, instantiated per source format
+   * Converts the image in spans of VIC_GPR_SPAN_BUFFER_SIZE pixels and renders them via span_horz()
+   * \param top_left Top/left vertex of the image
+   * \param bottom_right Bottom/right vertex of the image, included
+   * \param data Image data in the given format
+   */
+  template<color::format_type Format>
+  void blit(vertex_type top_left, vertex_type bottom_right, const std::uint8_t* data)
+  {
+    const std::uint16_t width  = static_cast<std::uint16_t>(bottom_right.x - top_left.x + 1);
+    const std::size_t   stride = color::pixel_kernel<Format>::stride(width);
+
+    color::value_type span[VIC_GPR_SPAN_BUFFER_SIZE];
+    for (vertex_type v = top_left; v.y <= bottom_right.y; ++v.y, data += stride) {
+      for (std::uint16_t x = 0U; x < width; ) {
+        const std::uint16_t len = (width - x < VIC_GPR_SPAN_BUFFER_SIZE) ? static_cast<std::uint16_t>(width - x) : static_cast<std::uint16_t>(VIC_GPR_SPAN_BUFFER_SIZE);
+        color::span_to_argb<Format>(span, data, x, len);
+        gamma_alpha(span, len);
+        span_horz({ static_cast<std::int16_t>(top_left.x + x), v.y }, len, span);
+        x = static_cast<std::uint16_t>(x + len);
+      }
+    }
   }
 
 
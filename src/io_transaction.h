@@ -0,0 +1,179 @@
+///////////////////////////////////////////////////////////////////////////////
+// \author (c) Marco Paland (info@paland.com)
+//             2014-2017, PALANDesign Hannover, Germany
+//
+// \license The MIT License (MIT)
+//
+// This file is part of the vic library.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// \brief Transaction buffer for device writes
+// Heads on a device interface (SPI, I²C, UART) append their register/index/data writes
+// to the buffer instead of calling io::dev::write for every few bytes. Consecutive writes
+// with the same option (register selection) are coalesced and passed as one burst, so the
+// per transaction overhead (chip select, syscall, DMA setup) is paid once per burst.
+// The buffer is flushed if the option changes, if it's full, before a delay and by flush(),
+// which the heads call on present and before reading from the device.
+// The buffer size is set by VIC_IO_TRANSACTION_BUFFER_SIZE in vic_cfg.h, a size of 0
+// passes every write directly to io::dev::write.
+// Write errors of buffered data are returned by the write or flush call which passes the burst.
+//
+// Usage (in a head):
+// io::transaction<> io_(device_handle);
+// io_.write(1U, data, 2U);     // appended to the buffer
+// io_.flush();                 // on present
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _VIC_IO_TRANSACTION_H_
+#define _VIC_IO_TRANSACTION_H_
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+#include "vic_cfg.h"
+#include "io.h"
+
+
+namespace vic {
+namespace io {
+
+
+/**
+ * Transaction buffer
+ * \param Buffer_Size Size of the buffer in bytes, 0 disables buffering
+ */
+template<std::size_t Buffer_Size = VIC_IO_TRANSACTION_BUFFER_SIZE>
+class transaction
+{
+public:
+
+  /**
+   * ctor
+   * \param device_handle Logical device handle, all writes go to this device
+   */
+  explicit transaction(dev::handle_type device_handle)
+    : device_handle_(device_handle)
+    , option_(0U)
+    , length_(0U)
+  { }
+
+
+  /**
+   * Append data to the buffer
+   * Data with the option of the buffered data is coalesced, data with another option flushes the buffer
+   * before. A full buffer is flushed, data larger than the buffer is written directly.
+   * \param option Optional data for the device like register selection
+   * \param data_out Data to write
+   * \param data_out_length Data length
+   * \return true if successful
+   */
+  bool write(std::uint32_t option, const std::uint8_t* data_out, std::size_t data_out_length)
+  {
+    bool res = true;
+    if (length_ && ((option != option_) || (length_ + data_out_length > Buffer_Size))) {
+      res = flush();
+    }
+    if (data_out_length > Buffer_Size) {
+      return dev::write(device_handle_, option, data_out, data_out_length, nullptr, 0U) && res;
+    }
+    std::memcpy(&buffer_[length_], data_out, data_out_length);
+    option_  = option;
+    length_ += data_out_length;
+    if (length_ == Buffer_Size) {
+      res = flush() && res;
+    }
+    return res;
+  }
+
+
+  /**
+   * Write the buffered data to the device
+   * \return true if successful
+   */
+  bool flush()
+  {
+    if (!length_) {
+      return true;
+    }
+    const std::size_t length = length_;
+    length_ = 0U;
+    return dev::write(device_handle_, option_, buffer_, length, nullptr, 0U);
+  }
+
+
+  /**
+   * Flush the buffer and delay
+   * \param time_to_delay Milliseconds [ms] to delay
+   */
+  void delay(std::uint32_t time_to_delay)
+  {
+    (void)flush();
+    io::delay(time_to_delay);
+  }
+
+
+  // return the device handle
+  inline dev::handle_type handle() const
+  { return device_handle_; }
+
+
+private:
+
+  const dev::handle_type  device_handle_;         // logical device handle
+  std::uint32_t           option_;                // option of the buffered data
+  std::size_t             length_;                // count of buffered bytes
+  std::uint8_t            buffer_[Buffer_Size];   // buffered data
+};
+
+
+/**
+ * Unbuffered transaction, every write is passed directly to the device
+ */
+template<>
+class transaction<0U>
+{
+public:
+
+  explicit transaction(dev::handle_type device_handle)
+    : device_handle_(device_handle)
+  { }
+
+  inline bool write(std::uint32_t option, const std::uint8_t* data_out, std::size_t data_out_length)
+  { return dev::write(device_handle_, option, data_out, data_out_length, nullptr, 0U); }
+
+  inline bool flush()
+  { return true; }
+
+  inline void delay(std::uint32_t time_to_delay)
+  { io::delay(time_to_delay); }
+
+  inline dev::handle_type handle() const
+  { return device_handle_; }
+
+private:
+
+  const dev::handle_type  device_handle_;         // logical device handle
+};
+
+} // namespace io
+} // namespace vic
+
+#endif  // _VIC_IO_TRANSACTION_H_
@@ -0,0 +1,490 @@
+///////////////////////////////////////////////////////////////////////////////
+// \author (c) Marco Paland (info@paland.com)
+//             2017-2017, PALANDesign Hannover, Germany
+//
+// \license The MIT License (MIT)
+//
+// This file is part of the vic library.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// \brief Static dispatch renderer
+// Wraps a concrete graphic head and renders the pixel intensive primitives with
+// direct (qualified, inlinable) calls into the head's pixel and span functions
+// instead of the virtual gpr/txr path.
+// The renderer IS the head, so it can still be passed as drv& to multihead and ctrls.
+//
+// Usage:
+// vic::renderer<vic::head::ILI9325<240U, 320U> > _head(device_handle, nullptr, nullptr, false);
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _VIC_RENDERER_H_
+#define _VIC_RENDERER_H_
+
+#include "drv.h"
+
+
+namespace vic {
+
+
+/**
+ * Static dispatch renderer
+ * \param Head Concrete graphic head (driver) type
+ */
+template<class Head>
+class renderer : public Head
+{
+public:
+
+  // inherit the head ctors
+  using Head::Head;
+
+  // keep the non overridden overloads of the head visible
+  using Head::plot;
+  using Head::box;
+  using Head::rectangle;
+
+
+///////////////////////////////////////////////////////////////////////////////
+// G R A P H I C   P R I M I T I V E   F U N C T I O N S
+
+  /**
+   * Plot a point (one pixel) in the actual drawing (pen) color
+   * \param point Vertex to plot
+   */
+  inline void plot(vertex_type point)
+  {
+    Head::drv_pixel_set_color(point, this->pen_get_color(point));
+    this->present();
+  }
+
+
+  /**
+   * Plot a point (one pixel) with the given color, drawing color is not affected
+   * \param point Vertex to plot
+   * \param color Color of the pixel
+   */
+  inline void plot(vertex_type point, color::value_type color)
+  {
+    Head::drv_pixel_set_color(point, color);
+    this->present();
+  }
+
+
+  /**
+   * Draw a line in drawing (pen) color
+   * Lines with pen shape or anti aliasing are passed to the generic gpr renderer
+   * \param v0 Start vertex, included in line
+   * \param v1 End vertex, included in line
+   */
+  void line(vertex_type v0, vertex_type v1)
+  {
+    if (this->pen_shape_ || this->anti_aliasing_) {
+      Head::line(v0, v1);
+      return;
+    }
+    if (v0.y == v1.y) {
+      render_line_horz(v0, v1);
+    }
+    else if (v0.x == v1.x) {
+      render_line_vert(v0, v1);
+    }
+    else {
+      // Bresenham line algorithm
+      const std::int16_t dx = v1.x > v0.x ? v1.x - v0.x : v0.x - v1.x;
+      const std::int16_t dy = v1.y > v0.y ? v1.y - v0.y : v0.y - v1.y;
+      const std::int16_t sx = v1.x > v0.x ? 1 : -1;
+      const std::int16_t sy = v1.y > v0.y ? 1 : -1;
+            std::int16_t er = dx - dy;
+      const bool              is_function = this->pen_color_is_function();
+      const color::value_type color       = this->pen_get_color();
+      for (;;) {
+        Head::drv_pixel_set_color(v0, is_function ? this->pen_get_color(v0) : color);
+        if (v0 == v1) {
+          break;
+        }
+        const std::int16_t er2 = er * 2;
+        if (er2 + dy > 0) {
+          er -= dy;
+          v0.x += sx;
+        }
+        if (er2 < dx) {
+          er += dx;
+          v0.y += sy;
+        }
+      }
+    }
+    this->present();
+  }
+
+
+  /**
+   * Draw a rectangle (frame) with the current pen
+   * \param v0 top/left vertex
+   * \param v1 bottom/right vertex
+   */
+  void rectangle(vertex_type v0, vertex_type v1)
+  {
+    this->present_lock();
+    line(v0, { v0.x, v1.y });
+    line({ v0.x, v1.y }, v1);
+    line(v1, { v1.x, v0.y });
+    line({ v1.x, v0.y }, v0);
+    this->present_lock(false);    // unlock and present
+  }
+
+
+  /**
+   * Draw a box (filled rectangle) with rounded corners
+   * \param v0 top/left vertex
+   * \param v1 bottom/right vertex
+   * \param border_radius Radius of the corner, 0 for angular
+   */
+  void box(vertex_type v0, vertex_type v1, std::uint16_t border_radius)
+  {
+    // make sure v0 is top/left
+    this->vertex_top_left(v0, v1);
+
+    this->present_lock();
+    render_box({ static_cast<std::int16_t>(v0.x + border_radius), v0.y }, { static_cast<std::int16_t>(v1.x - border_radius), static_cast<std::int16_t>(v0.y + border_radius) });
+    render_box({ v0.x, static_cast<std::int16_t>(v0.y + border_radius) }, { v1.x, static_cast<std::int16_t>(v1.y - border_radius) });
+    render_box({ static_cast<std::int16_t>(v0.x + border_radius), static_cast<std::int16_t>(v1.y - border_radius) }, { static_cast<std::int16_t>(v1.x - border_radius), v1.y });
+    disc_sector({ static_cast<std::int16_t>(v1.x - border_radius), static_cast<std::int16_t>(v0.y + border_radius) }, border_radius, 0U);
+    disc_sector({ static_cast<std::int16_t>(v0.x + border_radius), static_cast<std::int16_t>(v0.y + border_radius) }, border_radius, 1U);
+    disc_sector({ static_cast<std::int16_t>(v0.x + border_radius), static_cast<std::int16_t>(v1.y - border_radius) }, border_radius, 2U);
+    disc_sector({ static_cast<std::int16_t>(v1.x - border_radius), static_cast<std::int16_t>(v1.y - border_radius) }, border_radius, 3U);
+    this->present_lock(false);    // unlock and present
+  }
+
+
+  /**
+   * Draw multiple connected lines
+   * \param vertexes Pointer to array of vertexes, at least 2
+   * \param vertex_count Number of vertexes in the array, at least 2
+   */
+  void polyline(const vertex_type* vertexes, std::size_t vertex_count)
+  {
+    if (vertex_count < 2U) {
+      return;
+    }
+    this->present_lock();
+    for (std::size_t n = 0U; n < vertex_count - 1U; ++n) {
+      line(vertexes[n], vertexes[n + 1U]);
+    }
+    this->present_lock(false);    // present
+  }
+
+
+  /**
+   * Draw a triangle
+   * \param v0 value, included in triangle
+   * \param v1 value, included in triangle
+   * \param v2 value, included in triangle
+   */
+  void triangle(vertex_type v0, vertex_type v1, vertex_type v2)
+  {
+    this->present_lock();
+    line(v0, v1);
+    line(v1, v2);
+    line(v2, v0);
+    this->present_lock(false);  // present
+  }
+
+
+  /**
+   * Draw a solid (filled) triangle
+   * Anti aliased triangles are passed to the generic gpr renderer
+   * \param v0 value, included in triangle
+   * \param v1 value, included in triangle
+   * \param v2 value, included in triangle
+   */
+  void triangle_solid(vertex_type v0, vertex_type v1, vertex_type v2)
+  {
+    if (this->anti_aliasing_) {
+      Head::triangle_solid(v0, v1, v2);
+      return;
+    }
+
+    // compute triangle bounding box
+    const std::int16_t min_x = util::min3(v0.x, v1.x, v2.x);
+    const std::int16_t min_y = util::min3(v0.y, v1.y, v2.y);
+    const std::int16_t max_x = util::max3(v0.x, v1.x, v2.x);
+    const std::int16_t max_y = util::max3(v0.y, v1.y, v2.y);
+
+    // degenerated triangles
+    if (min_y == max_y) {
+      render_line_horz({ min_x, min_y }, { max_x, min_y });
+      this->present();
+      return;
+    }
+    if (min_x == max_x) {
+      render_line_vert({ min_x, min_y }, { min_x, max_y });
+      this->present();
+      return;
+    }
+
+    // triangle setup
+    const std::int16_t a01 = v0.y - v1.y, B01 = v1.x - v0.x;
+    const std::int16_t a12 = v1.y - v2.y, B12 = v2.x - v1.x;
+    const std::int16_t a20 = v2.y - v0.y, B20 = v0.x - v2.x;
+
+    // Barycentric coordinates at minX/minY corner
+    vertex_type p = { min_x, min_y };
+    std::int16_t w0_row = util::orient_2d(v1, v2, p);
+    std::int16_t w1_row = util::orient_2d(v2, v0, p);
+    std::int16_t w2_row = util::orient_2d(v0, v1, p);
+
+    // rasterize
+    for (p.y = min_y; p.y <= max_y; ++p.y) {
+      // Barycentric coordinates at start of row
+      std::int16_t w0 = w0_row, w1 = w1_row, w2 = w2_row, l_x = 0;
+      bool inside = false;
+      for (p.x = min_x; p.x <= max_x; ++p.x) {
+        // if p is on or inside all edges, render the pixel
+        if (!inside && w0 <= 0 && w1 <= 0 && w2 <= 0) {
+          inside = true;
+          l_x = p.x;
+        }
+        if (inside && (w0 + a12 > 0 || w1 + a20 > 0 || w2 + a01 > 0)) {
+          render_line_horz({ l_x, p.y }, { p.x, p.y });
+          break;
+        }
+        // one step to the right
+        w0 += a12; w1 += a20; w2 += a01;
+      }
+      // one row step
+      w0_row += B12; w1_row += B20; w2_row += B01;
+    }
+    this->present();
+  }
+
+
+  /**
+   * Draw a disc (filled circle)
+   * Anti aliased discs are passed to the generic gpr renderer
+   * \param center Center value
+   * \param radius Disc radius
+   */
+  void disc(vertex_type center, std::uint16_t radius)
+  {
+    if (this->anti_aliasing_) {
+      Head::disc(center, radius);
+      return;
+    }
+
+    radius++;
+    const std::int16_t radius_sqr = radius * radius;
+    for (std::int16_t y = -radius, x = 0; y <= 0; ++y) {
+      // the left edge moves monotonically left while approaching the center row
+      while ((x > -radius) && ((x - 1) * (x - 1) + y * y < radius_sqr)) {
+        --x;
+      }
+      if (x * x + y * y >= radius_sqr) {
+        continue;
+      }
+      render_line_horz({ static_cast<std::int16_t>(center.x + x), static_cast<std::int16_t>(center.y + y) }, { static_cast<std::int16_t>(center.x - x), static_cast<std::int16_t>(center.y + y) });
+      if (y) {
+        render_line_horz({ static_cast<std::int16_t>(center.x + x), static_cast<std::int16_t>(center.y - y) }, { static_cast<std::int16_t>(center.x - x), static_cast<std::int16_t>(center.y - y) });
+      }
+    }
+    this->present();
+  }
+
+
+  /**
+   * Draw a disc sector (filled quarter circle)
+   * Anti aliased sectors are passed to the generic gpr renderer
+   * \param center Center value
+   * \param radius Disc radius
+   * \param quadrant Quadrant number: 0: top/right, 1: top/left, 2: bottom/left, 3: bottom/right
+   */
+  void disc_sector(vertex_type center, std::uint16_t radius, std::uint8_t quadrant)
+  {
+    if (this->anti_aliasing_) {
+      Head::disc_sector(center, radius, quadrant);
+      return;
+    }
+
+    radius++;
+    const std::int16_t radius_sqr = radius * radius;
+    for (std::int16_t y = -radius, x = 0; y <= 0; ++y) {
+      while ((x > -radius) && ((x - 1) * (x - 1) + y * y < radius_sqr)) {
+        --x;
+      }
+      if (x * x + y * y >= radius_sqr) {
+        continue;
+      }
+      switch (quadrant) {
+        case 0 :
+          render_line_horz({ center.x, static_cast<std::int16_t>(center.y + y) }, { static_cast<std::int16_t>(center.x - x), static_cast<std::int16_t>(center.y + y) });
+          break;
+        case 1 :
+          render_line_horz({ static_cast<std::int16_t>(center.x + x), static_cast<std::int16_t>(center.y + y) }, { center.x, static_cast<std::int16_t>(center.y + y) });
+          break;
+        case 2 :
+          render_line_horz({ static_cast<std::int16_t>(center.x + x), static_cast<std::int16_t>(center.y - y) }, { center.x, static_cast<std::int16_t>(center.y - y) });
+          break;
+        case 3 :
+          render_line_horz({ center.x, static_cast<std::int16_t>(center.y - y) }, { static_cast<std::int16_t>(center.x - x), static_cast<std::int16_t>(center.y - y) });
+          break;
+        default :
+          break;
+      }
+    }
+    this->present();
+  }
+
+
+///////////////////////////////////////////////////////////////////////////////
+// T E X T   F U C T I O N S
+
+  /**
+   * Output a single ASCII/UNICODE char at the actual cursor position
+   * 1 bpp uncompressed (non subpixel) fonts in normal text mode are rendered as horizontal runs with direct span calls,
+   * all other fonts and text modes are passed to the generic txr renderer
+   * \param ch Output character in 21 bit ASCII/UNICODE (NOT UTF-8) format, 00-7F is compatible with ASCII
+   */
+  virtual void text_char(std::uint32_t ch)
+  {
+    if (ch < 0x20U) {
+      // ignore non characters
+      return;
+    }
+    if (this->text_mode_ != text_mode_normal) {
+      Head::text_char(ch);
+      return;
+    }
+
+    font::glyph_type glyph;
+    if (!this->text_glyph_get(ch, glyph)) {
+      // char not found
+      return;
+    }
+    if ((glyph.font->attr & (font::AA_MASK | font::FORMAT_MASK | font::SUBPIXEL_MASK)) != (font::AA_NONE | font::FORMAT_RAW | font::SUBPIXEL_NONE)) {
+      // glyph out of an antialiased, compressed or subpixel (fallback) font
+      Head::text_char(ch);
+      return;
+    }
+
+    // render the set bits (MSB first) of each glyph row as runs
+    const std::uint8_t* data = glyph.data;
+    const std::int16_t  px   = static_cast<std::int16_t>(this->text_x_act_ + glyph.xpos);
+    for (std::uint_fast8_t y = 0U; y < glyph.ysize; ++y, data += glyph.bytes_per_line) {
+      const std::int16_t py = static_cast<std::int16_t>(this->text_y_act_ + glyph.ypos + y);
+      for (std::uint_fast8_t x = 0U; x < glyph.xsize; ) {
+        if (!((data[x >> 3U] << (x & 0x07U)) & 0x80U)) {
+          ++x;
+          continue;
+        }
+        const std::uint_fast8_t xs = x;
+        while (++x < glyph.xsize && ((data[x >> 3U] << (x & 0x07U)) & 0x80U)) { }
+        render_line_horz({ static_cast<std::int16_t>(px + xs), py }, { static_cast<std::int16_t>(px + x - 1U), py });
+      }
+    }
+    this->text_x_act_ = static_cast<std::int16_t>(this->text_x_act_ + glyph.xdist);
+  }
+
+
+///////////////////////////////////////////////////////////////////////////////
+
+private:
+
+  /**
+   * Helpers to detect at compile time if the head provides its own span_horz() fill kernel.
+   * If the head doesn't override it, &renderer::span_horz is a pointer to a gpr member.
+   */
+  static constexpr bool span_is_native(void (gpr::*)(vertex_type, std::uint16_t, color::value_type))
+  { return false; }
+
+  template<class C>
+  static constexpr bool span_is_native(void (C::*)(vertex_type, std::uint16_t, color::value_type))
+  { return true; }
+
+
+  /**
+   * Render a horizontal span with direct calls into the head
+   * \param start Left vertex of the span
+   * \param length Span length in pixel
+   * \param color Color of the span
+   */
+  inline void render_span(vertex_type start, std::uint16_t length, color::value_type color)
+  {
+    if (span_is_native(&renderer::span_horz)) {
+      Head::span_horz(start, length, color);
+    }
+    else {
+      for (; length; --length, ++start.x) {
+        Head::drv_pixel_set_color(start, color);
+      }
+    }
+  }
+
+
+  /**
+   * Render a horizontal line in pen color, no present is called
+   * \param v0 Start vertex, included in line
+   * \param v1 End vertex, included in line, y component is ignored
+   */
+  inline void render_line_horz(vertex_type v0, vertex_type v1)
+  {
+    this->vertex_min_x(v0, v1);
+    if (this->pen_color_is_function()) {
+      for (; v0.x <= v1.x; ++v0.x) {
+        Head::drv_pixel_set_color(v0, this->pen_get_color(v0));
+      }
+    }
+    else {
+      render_span(v0, static_cast<std::uint16_t>(v1.x - v0.x + 1), this->pen_get_color());
+    }
+  }
+
+
+  /**
+   * Render a vertical line in pen color, no present is called
+   * \param v0 Start vertex, included in line
+   * \param v1 End vertex, included in line, x component is ignored
+   */
+  inline void render_line_vert(vertex_type v0, vertex_type v1)
+  {
+    this->vertex_min_y(v0, v1);
+    const bool              is_function = this->pen_color_is_function();
+    const color::value_type color       = this->pen_get_color();
+    for (; v0.y <= v1.y; ++v0.y) {
+      Head::drv_pixel_set_color(v0, is_function ? this->pen_get_color(v0) : color);
+    }
+  }
+
+
+  /**
+   * Render a box in pen color, no present is called
+   * \param v0 top/left vertex
+   * \param v1 bottom/right vertex
+   */
+  inline void render_box(vertex_type v0, vertex_type v1)
+  {
+    this->vertex_min_y(v0, v1);
+    for (; v0.y <= v1.y; ++v0.y) {
+      render_line_horz(v0, { v1.x, v0.y });
+    }
+  }
+};
+
+} // namespace vic
+
+#endif  // _VIC_RENDERER_H_
@@ -32,19 +32,61 @@
 #ifndef _VIC_TXR_H_
 #define _VIC_TXR_H_
 
+#include <cstring>
+
 #include "base.h"
 #include "font.h"
+#include "glyph_cache.h"
 
 
 namespace vic {
 
 
 typedef enum tag_text_mode_type {
-  text_mode_normal = 0,
-  text_mode_inverse
+  text_mode_normal = 0,   // transparent, only the glyph pixels are drawn in pen color
+  text_mode_inverse,      // opaque cells, glyph in background color on pen color
+  text_mode_opaque        // opaque cells, glyph in pen color on background color
 } text_mode_type;
 
 
+typedef enum tag_text_subpixel_type {
+  text_subpixel_none = 0, // no (known) LCD stripe panel, subpixel fonts are rendered as grayscale AA
+  text_subpixel_rgb,      // stripe order red, green, blue from left to right
+  text_subpixel_bgr       // stripe order blue, green, red from left to right
+} text_subpixel_type;
+
+
+typedef enum tag_text_align_type {
+  text_align_left = 0,    // lines are left aligned
+  text_align_center,      // lines are centered
+  text_align_right,       // lines are right aligned
+  text_align_justify      // wrapped lines are stretched to the box width, the last paragraph line is left aligned
+} text_align_type;
+
+
+// positioned text run (one line) of a text layout
+typedef struct tag_text_run_type {
+  const std::uint8_t* text;         // first char of the run (UTF-8)
+  std::uint16_t       length;       // length of the run in bytes
+  vertex_type         pos;          // top/left position of the run
+  std::uint16_t       width;        // run width in pixel, including the ellipsis
+  std::uint8_t        space_extra;  // justification: additional pixels per space
+  std::uint8_t        space_rem;    // justification: additional pixel for the first space_rem spaces
+  bool                ellipsis;     // true if the run is truncated and ends with an ellipsis
+} text_run_type;
+
+
+// text layout, the run storage is provided by the caller
+typedef struct tag_text_layout_type {
+  text_run_type*      run;          // run array
+  std::uint16_t       run_size;     // size of the run array
+  std::uint16_t       run_count;    // used runs
+  std::uint16_t       width;        // width of the widest run
+  std::uint16_t       height;       // height of all runs
+  bool                truncated;    // true if the text didn't fit completely into the box
+} text_layout_type;
+
+
 /**
  * TeXt Renderer
  */
@@ -58,10 +100,15 @@ public:
    */
   txr()
     : text_font_(nullptr)
+    , text_font_set_(nullptr)
     , text_x_set_(0)
     , text_x_act_(0)
     , text_y_act_(0)
     , text_mode_(text_mode_normal)
+    , text_subpixel_(true)
+    , text_cache_(nullptr)
+    , text_alpha_lut_alpha_(0x100U)
+    , text_alpha_lut_gamma_(nullptr)
   { }
 
 
@@ -75,7 +122,32 @@ public:
    */
   inline virtual void text_font_select(const font::font_type& font)
   {
-    text_font_ = &font;
+    text_font_     = &font;
+    text_font_set_ = nullptr;
+    text_index_.build(font);
+  }
+
+
+  /**
+   * Select a font set, chars missing in the primary font are rendered out of the fallback fonts
+   * The line height is given by the primary (first) font, the set must not be empty
+   * \param set Font set to use, must stay valid as long as it is selected
+   */
+  inline virtual void text_font_set_select(font::font_set& set)
+  {
+    text_font_     = set.primary();
+    text_font_set_ = &set;
+  }
+
+
+  /**
+   * Set the glyph cache
+   * Rendered glyphs are stored in the cache and redrawn out of it as long as font and color don't change
+   * \param cache Glyph cache to use, nullptr to disable caching
+   */
+  inline void text_cache_set(glyph_cache* cache)
+  {
+    text_cache_ = cache;
   }
 
 
@@ -102,7 +174,9 @@ public:
 
   /**
    * Set the text mode
-   * \param mode Set normal or inverse video
+   * In opaque and inverse mode the complete char cell (including the gap to the next char)
+   * is rendered in one pass, so changing text can be overwritten without clearing it first
+   * \param mode Set normal, opaque or inverse video
    */
   virtual void text_mode(text_mode_type mode)
   {
@@ -110,6 +184,29 @@ public:
   }
 
 
+  /**
+   * Enable or disable subpixel (LCD stripe) rendering of subpixel fonts (font::SUBPIXEL_3X)
+   * The 3x glyph samples are FIR filtered and blended per color channel, this needs a head which
+   * declares its stripe order. On other heads, rotated and when disabled subpixel fonts are rendered as grayscale AA.
+   * In opaque text modes the one pixel fringe of the filter is clipped by the char cell
+   * \param enable True to render subpixel fonts per color channel, this is the default
+   */
+  virtual void text_subpixel(bool enable)
+  {
+    text_subpixel_ = enable;
+  }
+
+
+  /**
+   * Returns the subpixel stripe order of the screen
+   * \return Stripe order in screen x direction, text_subpixel_none if the head has no (known) LCD stripe panel
+   */
+  virtual text_subpixel_type text_subpixel_order() const
+  {
+    return text_subpixel_none;
+  }
+
+
   /**
    * Clear actual line from cursor pos to end
    */
@@ -137,89 +234,79 @@ public:
   /**
    * Output a single ASCII/UNICODE char at the actual cursor position
    * The cursor position is moved by the char width (distance)
-   * \param ch Output character in 16 bit ASCII/UNICODE (NOT UTF-8) format, 00-7F is compatible with ASCII
+   * \param ch Output character in 21 bit ASCII/UNICODE (NOT UTF-8) format, 00-7F is compatible with ASCII
    */
-  virtual void text_char(std::uint16_t ch)
+  virtual void text_char(std::uint32_t ch)
   {
-    const std::uint8_t color_depth = (text_font_->attr & font::AA_MASK);
-    const std::uint8_t color_mask = (1U << color_depth) - 1U;
-    const std::uint8_t color_shift = 8U - color_depth;
-
     if (ch < 0x20U) {
       // ignore non characters
       return;
     }
 
-    if ((text_font_->attr & font::ENCODING_MASK) == font::ENCODING_UNICODE) {
-      // extended (UNICODE) font
-      const font::prop_ext_type* font_prop_ext = text_font_->font_type_type.prop_ext;
-      do {
-        if (ch >= font_prop_ext->first && ch <= font_prop_ext->last) {
-          // found char
-          const font::charinfo_ext_type* info = &font_prop_ext->char_info_ext[ch - font_prop_ext->first];
-          for (std::uint_fast8_t y = 0U; y < info->ysize; ++y) {
-            std::uint16_t d = (1U + ((info->xsize - 1U) * color_depth / 8U)) * y;
-            for (std::uint_fast8_t x = 0U; x < info->xsize; ++x) {
-              std::uint16_t intensity = (info->data[d + ((x * color_depth) >> 3U)] >> ((8U - (x + 1U) * color_depth) % 8U)) & color_mask;
-              if (intensity) {
-                intensity = ((intensity + 1U) << color_shift) - 1U;
-                drv_pixel_set_color({ static_cast<std::int16_t>(text_x_act_ + info->xpos + (std::int16_t)x), static_cast<std::int16_t>(text_y_act_ + info->ypos + (std::int16_t)y) }, color::set_alpha(pen_get_color(), static_cast<std::uint8_t>((std::uint16_t)color::get_alpha(pen_get_color()) * (255U - intensity) / 255U)));
-              }
-            }
-          }
-          text_x_act_ += info->xdist;
-          return;
-        }
-        font_prop_ext = font_prop_ext->next;
-      } while (font_prop_ext);
+    font::glyph_type glyph;
+    if (!text_glyph_get(ch, glyph)) {
       // char not found
       return;
     }
-    else {
-      // normal (ASCII) font
-      if ((text_font_->attr & font::TYPE_MASK) == font::TYPE_PROP) {
-        // prop font
-        const font::prop_type* font_prop = text_font_->font_type_type.prop;
-        do {
-          if (ch >= font_prop->first && ch <= font_prop->last) {
-            // found char
-            const font::charinfo_type* info = &font_prop->char_info[ch - font_prop->first];
-            for (std::uint_fast8_t y = 0U; y < text_font_->ysize; ++y) {
-              std::uint16_t d = (1U + ((info->xsize - 1U) * color_depth / 8U)) * y;
-              for (std::uint_fast8_t x = 0U; x < info->xsize; ++x) {
-                std::uint16_t intensity = (info->data[d + ((x * color_depth) >> 3U)] >> ((8U - (x + 1U) * color_depth) % 8U)) & color_mask;
-                if (intensity) {
-                  intensity = ((intensity + 1U) << color_shift) - 1U;
-                  drv_pixel_set_color({ static_cast<std::int16_t>(text_x_act_ + (std::int16_t)x), static_cast<std::int16_t>(text_y_act_ + (std::int16_t)y) }, color::set_alpha(pen_get_color(), 255U - static_cast<std::uint8_t>((255U - color::get_alpha(pen_get_color())) * intensity / 255U)));
-                }
-              }
-            }
-            text_x_act_ += info->xdist;
-            return;
-          }
-          font_prop = font_prop->next;
-        } while (font_prop);
-        // char not found
-        return;
-      }
-      else {
-        // mono font
-        const font::mono_type* font_mono = text_font_->font_type_type.mono;
-        if (ch >= font_mono->first && ch <= font_mono->last) {
-          for (std::uint_fast8_t y = 0U; y < text_font_->ysize; ++y) {
-            std::uint16_t d = (ch - font_mono->first) * text_font_->ysize * font_mono->bytes_per_line + (std::int16_t)y * font_mono->bytes_per_line;
-            for (std::uint_fast8_t x = 0U; x < font_mono->xsize; ++x) {
-              std::uint16_t intensity = (font_mono->data[d + ((x * color_depth) >> 3U)] >> ((8U - (x + 1U) * color_depth) % 8U)) & color_mask;
-              if (intensity) {
-                intensity = ((intensity + 1U) << color_shift) - 1U;
-                drv_pixel_set_color({ static_cast<std::int16_t>(text_x_act_ + (std::int16_t)x), static_cast<std::int16_t>(text_y_act_ + (std::int16_t)y) }, color::set_alpha(pen_get_color(), 255U - static_cast<std::uint8_t>((255U - color::get_alpha(pen_get_color())) * intensity / 255U)));
-              }
-            }
-          }
-          text_x_act_ += font_mono->xsize;
-          return;
+
+    if (text_mode_ != text_mode_normal) {
+      // opaque cell
+      text_cell_render(ch, glyph);
+      return;
+    }
+
+    const vertex_type origin = { static_cast<std::int16_t>(text_x_act_ + glyph.xpos), static_cast<std::int16_t>(text_y_act_ + glyph.ypos) };
+    text_x_act_ += glyph.xdist;
+
+    // the filter of subpixel rendered glyphs adds a fringe of one pixel on both sides
+    const text_subpixel_type order  = text_subpixel_get(glyph);
+    const std::int16_t       fringe = (order != text_subpixel_none) ? 1 : 0;
+    if (!glyph.xsize || !glyph.ysize ||
+        !text_is_visible({ static_cast<std::int16_t>(origin.x - fringe), origin.y },
+                         { static_cast<std::int16_t>(origin.x + glyph.xsize - 1 + fringe), static_cast<std::int16_t>(origin.y + glyph.ysize - 1) })) {
+      // glyph is empty, completely off screen or clipped
+      return;
+    }
+
+    if (text_cache_ && (order == text_subpixel_none)) {
+      // subpixel rendered glyphs are blended over the screen content, so they can't be cached
+      const color::value_type color = pen_get_color();
+      const glyph_cache::key_type key = { glyph.font, ch, color, 0U, false, 0, 0U };
+      const glyph_cache::entry_type* entry = text_cache_->find(key);
+      if (!entry) {
+        // cache miss, render the glyph into a new slot
+        std::uint8_t buffer[VIC_TXR_GLYPH_BUFFER_SIZE];
+        font::glyph_type expanded = glyph;
+        glyph_cache::entry_type* slot = text_glyph_expand(expanded, buffer) ? text_cache_->insert(key, glyph.xsize, glyph.ysize) : nullptr;
+        if (slot) {
+          text_glyph_decode(expanded, color, slot->data);
+          entry = slot;
         }
       }
+      if (entry) {
+        text_glyph_render_cached(*entry, origin);
+        return;
+      }
+    }
+
+    if (font::samples(*glyph.font) > 1U) {
+      // subpixel glyph
+      text_glyph_render_subpixel(glyph, origin, order);
+      return;
+    }
+
+    if ((glyph.font->attr & font::FORMAT_MASK) == font::FORMAT_RLE) {
+      // compressed glyph
+      text_glyph_render_rle(glyph, origin);
+      return;
+    }
+
+    switch (glyph.font->attr & font::AA_MASK) {
+      case font::AA_NONE : text_glyph_render_mono(glyph, origin); break;
+      case font::AA_2    : text_glyph_render_aa<2U>(glyph, origin); break;
+      case font::AA_4    : text_glyph_render_aa<4U>(glyph, origin); break;
+      case font::AA_8    : text_glyph_render_aa<8U>(glyph, origin); break;
+      default            : break;
     }
   }
 
@@ -231,35 +318,28 @@ public:
    */
   virtual std::uint16_t text_string(const std::uint8_t* string)
   {
-    std::uint16_t ch, cnt = 0U;
+    std::uint32_t ch;
+    std::uint16_t cnt = 0U;
     while (*string) {
-      if ((*string & 0x80U) == 0x00U) {
-        // 1 byte sequence (ASCII char)
-        ch = (std::uint16_t)(*string++ & 0x7FU);
+      // fast path for printable ASCII runs
+      for (std::size_t n = text_ascii_run(string); n; --n, ++cnt) {
+        text_char(*string++);
       }
-      else if ((*string & 0xE0U) == 0xC0U) {
-        // 2 byte UTF-8 sequence
-        ch = (((std::uint16_t)*string & 0x001FU) << 6U) | ((std::uint16_t)*(string + 1U) & 0x003FU);
-        string += 2U;
+      if (!*string) {
+        break;
       }
-      else if ((*string & 0xF0U) == 0xE0U) {
-        // 3 byte UTF-8 sequence
-        ch = (((std::uint16_t)*string & 0x000FU) << 12U) | (((std::uint16_t)*(string + 1U) & 0x003FU) << 6U) | ((std::uint16_t)*(string + 2U) & 0x003FU);
-        string += 3U;
-      }
-      else {
+      if (!text_utf8_next(string, ch)) {
         // unknown sequence
-        string++;
         continue;
       }
 
       // handling of special chars
-      if ((char)ch == '\n') {
+      if (ch == '\n') {
         // LF: X = 0, Y = next line
         text_x_act_ = text_x_set_;
         text_y_act_ = text_y_act_ + text_font_->ysize;
       }
-      else if ((char)ch == '\r') {
+      else if (ch == '\r') {
         // CR: X = 0
         text_x_act_ = text_x_set_;
       }
@@ -288,110 +368,1375 @@ public:
 
   /**
    * Output a rotated string
-   * \param pos Position in pixel on graphic displays, position in chars on text displays
+   * Rotated text is always rendered transparent (normal text mode)
+   * \param pos Position in pixel of the top/left corner of the first char (before rotation)
    * \param angle Angle in degree, 0� is horizontal right, counting anticlockwise
    * \param string Output string in ASCII/UTF-8 format, zero terminated
    * \return Number of written characters, not bytes (as a character may consist out of two bytes)
    */
   std::uint16_t text_string_rotate(vertex_type pos, std::uint16_t angle, const std::uint8_t* string)
   {
+    angle = static_cast<std::uint16_t>(angle % 360U);
+    if (!angle) {
+      return text_string_pos(pos, string);
+    }
     text_pos(pos);
-//  TBD
-    (void)angle; (void)string;
-    return 0U;
+    if (!drv_is_graphic()) {
+      // text heads can't rotate
+      return 0U;
+    }
+
+    const std::int32_t c = util::cos(static_cast<std::int16_t>(angle));   // normalized to 16384
+    const std::int32_t s = util::sin(static_cast<std::int16_t>(angle));   // normalized to 16384
+
+    // pen and line start position in 1/16384 pixel, the baseline direction is (c, -s)
+    std::int32_t lx = pos.x * 16384L, ly = pos.y * 16384L;
+    std::int32_t px = lx, py = ly;
+    std::uint32_t ch;
+    std::uint16_t cnt = 0U;
+    while (*string) {
+      if (!text_utf8_next(string, ch)) {
+        // unknown sequence
+        continue;
+      }
+      if (ch == '\n') {
+        // next line, perpendicular to the baseline
+        lx += s * text_font_->ysize;
+        ly += c * text_font_->ysize;
+        px = lx; py = ly;
+      }
+      else if (ch == '\r') {
+        px = lx; py = ly;
+      }
+      else {
+        const std::uint16_t dist = text_char_rotate(ch, { static_cast<std::int16_t>((px + 8192L) / 16384L), static_cast<std::int16_t>((py + 8192L) / 16384L) },
+                                                    static_cast<std::int16_t>(angle), c, s);
+        px += c * dist;
+        py -= s * dist;
+      }
+      cnt++;
+    }
+    present();
+    return cnt;
   }
 
 
   /**
    * Returns the width and height the rendered string would take.
    * The string is not rendered on screen
-   * \param width Width the rendered string would take
-   * \param height Height the rendered string would take
+   * \param width Width the rendered string would take (widest line), in pixel on graphic displays, in chars on text displays
+   * \param height Height the rendered string would take (all lines), in pixel on graphic displays, in chars on text displays
    * \param string String in UTF-8 format, zero terminated
    * \return Number of string characters, not bytes (as a character may consist out of two bytes)
    */
   std::uint16_t text_string_get_extend(std::uint16_t& width, std::uint16_t& height, const std::uint8_t* string) const
   {
-    std::uint16_t ch, cnt = 0U;
+    std::uint32_t ch;
+    std::uint16_t cnt = 0U, line = 0U;
+    width  = 0U;
+    height = text_line_height();
     while (*string) {
-      if ((*string & 0x80U) == 0x00U) {
-        // 1 byte sequence (ASCII char)
-        ch = (std::uint16_t)(*string++ & 0x7FU);
-      }
-      else if ((*string & 0xE0U) == 0xC0U) {
-        // 2 byte UTF-8 sequence
-        ch = (((std::uint16_t)*string & 0x001FU) << 6U) | ((std::uint16_t)*(string + 1U) & 0x003FU);
-        string += 2U;
+      // fast path for printable ASCII runs
+      for (std::size_t n = text_ascii_run(string); n; --n, ++cnt) {
+        line = static_cast<std::uint16_t>(line + text_char_width(*string++));
       }
-      else if ((*string & 0xF0U) == 0xE0U) {
-        // 3 byte UTF-8 sequence
-        ch = (((std::uint16_t)*string & 0x000FU) << 12U) | (((std::uint16_t)*(string + 1U) & 0x003FU) << 6U) | ((std::uint16_t)*(string + 2U) & 0x003FU);
-        string += 3U;
+      width = line > width ? line : width;
+      if (!*string) {
+        break;
       }
-      else {
+      if (!text_utf8_next(string, ch)) {
         // unknown sequence
-        string++;
         continue;
       }
+      if (ch == '\n') {
+        // next line
+        height = static_cast<std::uint16_t>(height + text_line_height());
+        line   = 0U;
+      }
+      else if (ch == '\r') {
+        line = 0U;
+      }
+      else {
+        line = static_cast<std::uint16_t>(line + text_char_width(ch));
+        width = line > width ? line : width;
+      }
+      cnt++;
+    }
+    return cnt;
+  }
 
-      if (drv_is_graphic())
-      {
-        if ((text_font_->attr & font::ENCODING_MASK) == font::ENCODING_UNICODE) {
-          // extended (UNICODE) font
-          const font::prop_ext_type* font_prop_ext = text_font_->font_type_type.prop_ext;
-          do {
-            if (ch >= font_prop_ext->first && ch <= font_prop_ext->last) {
-              // found char
-              const font::charinfo_ext_type* info = &font_prop_ext->char_info_ext[ch - font_prop_ext->first];
-              width += info->xdist;
-            }
-            font_prop_ext = font_prop_ext->next;
-          } while (font_prop_ext);
-          // char not found
+
+  /**
+   * Layout a string into a box
+   * The string is measured once, word-wrapped and aligned into runs, which are rendered by text_layout_render()
+   * The string must stay valid as long as the layout is used
+   * \param layout Layout, the run array must be provided by the caller
+   * \param string String in UTF-8 format, zero terminated
+   * \param top_left Top left corner of the box
+   * \param bottom_right Bottom right corner of the box
+   * \param align Line alignment
+   * \param wrap True to wrap lines at word boundaries (or chars, if a word doesn't fit into a line)
+   * \param ellipsis True to end the last visible line with "..." if the string is truncated
+   * \return Number of runs (lines)
+   */
+  std::uint16_t text_layout(text_layout_type& layout, const std::uint8_t* string, vertex_type top_left, vertex_type bottom_right,
+                            text_align_type align = text_align_left, bool wrap = true, bool ellipsis = true) const
+  {
+    if (top_left.x > bottom_right.x) { const std::int16_t t = top_left.x; top_left.x = bottom_right.x; bottom_right.x = t; }
+    if (top_left.y > bottom_right.y) { const std::int16_t t = top_left.y; top_left.y = bottom_right.y; bottom_right.y = t; }
+    const std::uint16_t box_width  = static_cast<std::uint16_t>(bottom_right.x - top_left.x + 1);
+    const std::uint16_t box_height = static_cast<std::uint16_t>(bottom_right.y - top_left.y + 1);
+    const std::uint16_t line_max   = text_line_height() ? static_cast<std::uint16_t>(box_height / text_line_height()) : 0U;
+    const std::uint16_t dots_width = static_cast<std::uint16_t>(3U * text_char_width('.'));
+
+    layout.run_count = 0U;
+    layout.width     = 0U;
+    layout.height    = 0U;
+    layout.truncated = false;
+
+    std::uint32_t ch;
+    while (*string && (layout.run_count < layout.run_size) && (layout.run_count < line_max)) {
+      // scan one line
+      const std::uint8_t* end    = nullptr;   // end of the line
+      const std::uint8_t* brk    = nullptr;   // end of the line at the last word break
+      const std::uint8_t* p      = string;
+      std::uint16_t       width  = 0U, brk_width  = 0U;
+      std::uint16_t       spaces = 0U, brk_spaces = 0U;
+      bool                hard   = true;      // line ends at a paragraph end ('\n' or end of string)
+      bool                blank  = false;     // last char was a space
+      while (*p) {
+        const std::uint8_t* q = p;
+        if (!text_utf8_next(q, ch)) {
+          p = q;
+          continue;
         }
-        else {
-          // normal (ASCII) font
-          if ((text_font_->attr & font::TYPE_MASK) == font::TYPE_PROP) {
-            // prop font
-            const font::prop_type* font_prop = text_font_->font_type_type.prop;
-            do {
-              if (ch >= font_prop->first && ch <= font_prop->last) {
-                // found char
-                const font::charinfo_type* info = &font_prop->char_info[ch - font_prop->first];
-                width += info->xdist;
-              }
-              font_prop = font_prop->next;
-            } while (font_prop);
-            // char not found
+        if (ch == '\n') {
+          end = p;
+          p   = q;
+          break;
+        }
+        const std::uint16_t w = text_char_width(ch);
+        if (ch == ' ') {
+          if (!blank && (p != string)) {
+            // word end
+            brk        = p;
+            brk_width  = width;
+            brk_spaces = spaces;
+          }
+          spaces++;
+        }
+        blank = (ch == ' ');
+        if (wrap && (width + w > box_width) && (p != string) && (ch != ' ')) {
+          // line is full
+          hard = false;
+          if (brk) {
+            end    = brk;
+            width  = brk_width;
+            spaces = brk_spaces;
+            // skip the spaces at the break
+            for (p = brk; *p == ' '; ++p) { }
           }
           else {
-            // mono font
-            const font::mono_type* font_mono = text_font_->font_type_type.mono;
-            if (ch >= font_mono->first && ch <= font_mono->last) {
-              width += font_mono->xsize;   // x-distance is xsize
-            }
+            // break within the word
+            end = p;
           }
+          break;
         }
+        width = static_cast<std::uint16_t>(width + w);
+        p = q;
       }
-      cnt++;
+      if (!end) {
+        end = p;
+      }
+
+      text_run_type& run = layout.run[layout.run_count++];
+      run.text        = string;
+      run.length      = static_cast<std::uint16_t>(end - string);
+      run.width       = width;
+      run.space_extra = 0U;
+      run.space_rem   = 0U;
+      run.ellipsis    = false;
+
+      const bool last = (layout.run_count == layout.run_size) || (layout.run_count == line_max);
+      if ((ellipsis && ((last && *p) || (width > box_width))) && (box_width >= dots_width)) {
+        // truncate the run so that the ellipsis fits
+        const std::uint8_t* t = string;
+        width = 0U;
+        for (const std::uint8_t* q = string; q < end; ) {
+          if (!text_utf8_next(q, ch)) {
+            continue;
+          }
+          const std::uint16_t w = text_char_width(ch);
+          if (width + w + dots_width > box_width) {
+            break;
+          }
+          width = static_cast<std::uint16_t>(width + w);
+          t = q;
+        }
+        run.length   = static_cast<std::uint16_t>(t - string);
+        run.width    = static_cast<std::uint16_t>(width + dots_width);
+        run.ellipsis = true;
+        hard         = true;
+      }
+
+      // alignment
+      std::int16_t x = top_left.x;
+      const std::uint16_t space = (box_width > run.width) ? static_cast<std::uint16_t>(box_width - run.width) : 0U;
+      switch (align) {
+        case text_align_center :
+          x = static_cast<std::int16_t>(x + space / 2U);
+          break;
+        case text_align_right :
+          x = static_cast<std::int16_t>(x + space);
+          break;
+        case text_align_justify :
+          if (!hard && spaces) {
+            run.space_extra = static_cast<std::uint8_t>((space / spaces) < 0xFFU ? (space / spaces) : 0xFFU);
+            run.space_rem   = static_cast<std::uint8_t>(run.space_extra < 0xFFU ? (space % spaces) : 0U);
+            run.width       = static_cast<std::uint16_t>(run.width + run.space_extra * spaces + run.space_rem);
+          }
+          break;
+        default :
+          break;
+      }
+      run.pos = { x, static_cast<std::int16_t>(top_left.y + (layout.run_count - 1U) * text_line_height()) };
+      layout.width  = run.width > layout.width ? run.width : layout.width;
+      layout.height = static_cast<std::uint16_t>(layout.height + text_line_height());
+      if (run.ellipsis || (run.width > box_width)) {
+        // the run is shortened or exceeds the box
+        layout.truncated = true;
+      }
+      string = p;
     }
-    width  = cnt;
-    height = 1U;
-    return cnt;
+    if (*string) {
+      // lines left over
+      layout.truncated = true;
+    }
+    return layout.run_count;
+  }
+
+
+  /**
+   * Render a text layout
+   * The layout is rendered without measuring it again
+   * \param layout Layout to render, created by text_layout()
+   */
+  void text_layout_render(const text_layout_type& layout)
+  {
+    std::uint32_t ch;
+    for (std::uint16_t r = 0U; r < layout.run_count; ++r) {
+      const text_run_type& run = layout.run[r];
+      text_pos(run.pos);
+      std::uint16_t spaces = 0U;
+      std::size_t   ascii  = 0U;
+      for (const std::uint8_t* p = run.text, * const end = run.text + run.length; p < end; ) {
+        // fast path for printable ASCII runs
+        if (!ascii) {
+          ascii = text_ascii_run(p, static_cast<std::size_t>(end - p));
+        }
+        if (ascii) {
+          ch = *p++;
+          --ascii;
+        }
+        else if (!text_utf8_next(p, ch)) {
+          continue;
+        }
+        text_char(ch);
+        if (ch == ' ') {
+          // justification
+          text_x_act_ = static_cast<std::int16_t>(text_x_act_ + run.space_extra + (spaces++ < run.space_rem ? 1U : 0U));
+        }
+      }
+      if (run.ellipsis) {
+        text_char('.'); text_char('.'); text_char('.');
+      }
+    }
+    present();
   }
 
 
 ///////////////////////////////////////////////////////////////////////////////
 
 protected:
+
+  /**
+   * Get the glyph of a char out of the actual selected font
+   * \param ch Char code in ASCII/UNICODE
+   * \param glyph Glyph info of the char
+   * \return true if the char exists in the font
+   */
+  inline bool text_glyph_get(std::uint32_t ch, font::glyph_type& glyph) const
+  {
+    return text_font_set_ ? text_font_set_->find(ch, glyph) : text_index_.find(ch, glyph);
+  }
+
+
+  /**
+   * Decode the next char of an UTF-8 string
+   * Malformed sequences (stray continuation bytes, overlong forms, surrogates, code points above U+10FFFF,
+   * truncated sequences) are skipped up to the first byte which doesn't belong to the sequence.
+   * That byte is not consumed, so the decoder never reads past the terminating zero.
+   * \param string String position, advanced to the next char
+   * \param ch Decoded char (21 bit UNICODE code point)
+   * \return false if the sequence is malformed (and skipped)
+   */
+  static inline bool text_utf8_next(const std::uint8_t*& string, std::uint32_t& ch)
+  {
+    const std::uint8_t lead = *string++;
+    if (lead < 0x80U) {
+      // 1 byte sequence (ASCII char)
+      ch = lead;
+      return true;
+    }
+
+    // valid range of the first continuation byte, limited for the leads which allow overlong forms,
+    // surrogates or code points above U+10FFFF
+    std::uint8_t lo = 0x80U, hi = 0xBFU;
+    std::uint_fast8_t count;
+    if (lead < 0xC2U) {
+      // continuation byte or overlong 2 byte sequence
+      return false;
+    }
+    else if (lead < 0xE0U) {
+      // 2 byte sequence
+      count = 1U;
+      ch    = lead & 0x1FU;
+    }
+    else if (lead < 0xF0U) {
+      // 3 byte sequence
+      count = 2U;
+      ch    = lead & 0x0FU;
+      lo    = (lead == 0xE0U) ? 0xA0U : lo;
+      hi    = (lead == 0xEDU) ? 0x9FU : hi;
+    }
+    else if (lead < 0xF5U) {
+      // 4 byte sequence
+      count = 3U;
+      ch    = lead & 0x07U;
+      lo    = (lead == 0xF0U) ? 0x90U : lo;
+      hi    = (lead == 0xF4U) ? 0x8FU : hi;
+    }
+    else {
+      // invalid lead byte
+      return false;
+    }
+
+    for (; count; --count) {
+      if ((*string < lo) || (*string > hi)) {
+        // invalid or truncated sequence (the terminating zero is no continuation byte)
+        return false;
+      }
+      ch = (ch << 6U) | (*string++ & 0x3FU);
+      lo = 0x80U;
+      hi = 0xBFU;
+    }
+    return true;
+  }
+
+
+  /**
+   * Returns the length of the printable ASCII run (0x20 - 0x7F) at the string start
+   * \param string String in UTF-8 format, zero terminated
+   * \return Number of printable ASCII chars (bytes)
+   */
+  static inline std::size_t text_ascii_run(const std::uint8_t* string)
+  {
+    const std::uint8_t* p = string;
+    while ((*p >= 0x20U) && (*p <= 0x7FU)) {
+      ++p;
+    }
+    return static_cast<std::size_t>(p - string);
+  }
+
+
+  /**
+   * Returns the length of the printable ASCII run (0x20 - 0x7F) at the start of a string of known length
+   * The string is checked 8 bytes at a time, words are only read within the length.
+   * \param string String in UTF-8 format
+   * \param length Length of the string in bytes
+   * \return Number of printable ASCII chars (bytes)
+   */
+  static inline std::size_t text_ascii_run(const std::uint8_t* string, std::size_t length)
+  {
+    const std::uint8_t* p   = string;
+    const std::uint8_t* end = string + length;
+    // a word ends the run if any byte is >= 0x80 (high bit set) or < 0x20 (borrow of the subtraction)
+    for (; end - p >= 8; p += 8U) {
+      std::uint64_t word;
+      std::memcpy(&word, p, 8U);
+      if ((word | ((word - 0x2020202020202020ULL) & ~word)) & 0x8080808080808080ULL) {
+        break;
+      }
+    }
+    // locate the end within the word or the tail
+    while ((p < end) && (*p >= 0x20U) && (*p <= 0x7FU)) {
+      ++p;
+    }
+    return static_cast<std::size_t>(p - string);
+  }
+
+
+  /**
+   * Returns the cursor advance of a char
+   * \param ch Char code
+   * \return Width in pixel on graphic displays, 1 on text displays, 0 if the char is not available
+   */
+  inline std::uint16_t text_char_width(std::uint32_t ch) const
+  {
+    if (!drv_is_graphic()) {
+      return 1U;
+    }
+    font::glyph_type glyph;
+    return text_glyph_get(ch, glyph) ? glyph.xdist : 0U;
+  }
+
+
+  /**
+   * Output a horizontal run of glyph pixels in the given color
+   * The default renders pixel by pixel, heads pass the run as span
+   * \param start Left vertex of the run
+   * \param length Run length in pixel
+   * \param color Run color
+   */
+  virtual void text_span(vertex_type start, std::uint16_t length, color::value_type color)
+  {
+    for (; length; --length, ++start.x) {
+      drv_pixel_set_color(start, color);
+    }
+  }
+
+
+  /**
+   * Output a horizontal run of (antialiased) glyph pixels
+   * \param start Left vertex of the run
+   * \param length Run length in pixel
+   * \param colors Pixel colors of the run
+   */
+  virtual void text_span(vertex_type start, std::uint16_t length, const color::value_type* colors)
+  {
+    for (; length; --length, ++start.x) {
+      drv_pixel_set_color(start, *colors++);
+    }
+  }
+
+
+  /**
+   * Test if a glyph box is visible at all
+   * \param top_left Top left corner of the glyph box
+   * \param bottom_right Bottom right corner of the glyph box
+   * \return False if the glyph can be culled
+   */
+  virtual bool text_is_visible(vertex_type top_left, vertex_type bottom_right) const
+  {
+    return (bottom_right.x >= 0) && (bottom_right.y >= 0) &&
+           (top_left.x < static_cast<std::int16_t>(screen_width())) && (top_left.y < static_cast<std::int16_t>(screen_height()));
+  }
+
+
+  /**
+   * Returns the stripe order a glyph is rendered with
+   * \param glyph Glyph
+   * \return Stripe order of the screen for glyphs of subpixel fonts, text_subpixel_none for grayscale rendering
+   */
+  inline text_subpixel_type text_subpixel_get(const font::glyph_type& glyph) const
+  {
+    return (text_subpixel_ && (font::samples(*glyph.font) > 1U)) ? text_subpixel_order() : text_subpixel_none;
+  }
+
+
+  /**
+   * Returns the coverage to alpha LUT of the given pen alpha
+   * The gamma LUT of the head is folded in, the LUT is only rebuilt if the pen alpha or the gamma LUT changes
+   * \param alpha Pen alpha
+   * \return LUT, mapping 8 bit glyph coverage to pixel alpha
+   */
+  inline const std::uint8_t* text_alpha_lut(std::uint8_t alpha)
+  {
+    const std::uint8_t* gamma = gamma_coverage();
+    if ((text_alpha_lut_alpha_ != alpha) || (text_alpha_lut_gamma_ != gamma)) {
+      for (std::uint16_t i = 0U; i < 256U; ++i) {
+        text_alpha_lut_[i] = static_cast<std::uint8_t>((alpha * (gamma ? gamma[i] : i) + 127U) / 255U);
+      }
+      text_alpha_lut_alpha_ = alpha;
+      text_alpha_lut_gamma_ = gamma;
+    }
+    return text_alpha_lut_;
+  }
+
+
   const font::font_type*  text_font_;       // actual selected font
+  font::index             text_index_;      // glyph index of the selected font
+  font::font_set*         text_font_set_;   // selected font set, nullptr if a single font is selected
   std::int16_t            text_x_set_;      // x cursor position for new line
   std::int16_t            text_x_act_;      // actual x cursor position
   std::int16_t            text_y_act_;      // actual y cursor position
   text_mode_type          text_mode_;       // text mode
+  bool                    text_subpixel_;   // subpixel rendering of subpixel fonts enabled
 
 private:
 
+  /**
+   * Render a 1 bpp glyph, runs of set bits are bit-scanned and output as spans
+   * \param glyph Glyph to render
+   * \param origin Top left screen vertex of the glyph
+   */
+  void text_glyph_render_mono(const font::glyph_type& glyph, vertex_type origin)
+  {
+    const color::value_type color = pen_get_color();
+    const std::uint8_t* row = glyph.data;
+    for (std::uint_fast8_t y = 0U; y < glyph.ysize; ++y, row += glyph.bytes_per_line) {
+      const std::int16_t py = static_cast<std::int16_t>(origin.y + y);
+      if ((py < 0) || (py >= static_cast<std::int16_t>(screen_height()))) {
+        continue;
+      }
+      for (std::uint_fast16_t x = 0U; x < glyph.xsize; ) {
+        // skip clear pixels, whole bytes at once
+        if (!(x & 0x07U) && !row[x >> 3U]) {
+          x += 8U;
+          continue;
+        }
+        if (!((row[x >> 3U] << (x & 0x07U)) & 0x80U)) {
+          ++x;
+          continue;
+        }
+        // scan the run of set pixels, whole bytes at once
+        const std::uint_fast16_t xs = x++;
+        while (x < glyph.xsize) {
+          if (!(x & 0x07U) && (row[x >> 3U] == 0xFFU)) {
+            x += 8U;
+          }
+          else if ((row[x >> 3U] << (x & 0x07U)) & 0x80U) {
+            ++x;
+          }
+          else {
+            break;
+          }
+        }
+        if (x > glyph.xsize) {
+          x = glyph.xsize;
+        }
+        text_span({ static_cast<std::int16_t>(origin.x + xs), py }, static_cast<std::uint16_t>(x - xs), color);
+      }
+    }
+  }
+
+
+  /**
+   * Render a compressed glyph, every RLE run of coverage is output as solid span
+   * \param glyph Glyph to render
+   * \param origin Top left screen vertex of the glyph
+   */
+  void text_glyph_render_rle(const font::glyph_type& glyph, vertex_type origin)
+  {
+    const std::uint8_t        depth = static_cast<std::uint8_t>(glyph.font->attr & font::AA_MASK);
+    const std::uint8_t        scale = static_cast<std::uint8_t>(255U / ((1U << depth) - 1U));
+    const color::value_type   color = pen_get_color();
+    const std::uint8_t*       lut   = text_alpha_lut(color::get_alpha(color));
+
+    const std::uint8_t* stream = glyph.data;
+    std::uint16_t length;
+    for (std::uint_fast8_t y = 0U; y < glyph.ysize; ++y) {
+      const std::int16_t py = static_cast<std::int16_t>(origin.y + y);
+      const bool visible = (py >= 0) && (py < static_cast<std::int16_t>(screen_height()));
+      for (std::uint16_t x = 0U; x < glyph.xsize; x = static_cast<std::uint16_t>(x + length)) {
+        const std::uint8_t coverage = font::rle_run(stream, depth, length);
+        if (coverage && visible) {
+          text_span({ static_cast<std::int16_t>(origin.x + x), py }, length, (depth == 1U) ? color : color::set_alpha(color, lut[coverage * scale]));
+        }
+      }
+    }
+  }
+
+
+  /**
+   * Render an antialiased glyph, runs of covered pixels are output as color spans
+   * \param Depth Bits per pixel of the glyph (2, 4 or 8)
+   * \param glyph Glyph to render
+   * \param origin Top left screen vertex of the glyph
+   */
+  template<std::uint8_t Depth>
+  void text_glyph_render_aa(const font::glyph_type& glyph, vertex_type origin)
+  {
+    const color::value_type   color = pen_get_color();
+    const std::uint8_t*       lut   = text_alpha_lut(color::get_alpha(color));
+
+    color::value_type buffer[VIC_GPR_SPAN_BUFFER_SIZE];
+    const std::uint8_t* row = glyph.data;
+    for (std::uint_fast8_t y = 0U; y < glyph.ysize; ++y, row += glyph.bytes_per_line) {
+      const std::int16_t py = static_cast<std::int16_t>(origin.y + y);
+      if ((py < 0) || (py >= static_cast<std::int16_t>(screen_height()))) {
+        continue;
+      }
+      std::uint16_t len = 0U, xs = 0U;
+      for (std::uint_fast16_t x = 0U; x < glyph.xsize; ++x) {
+        const std::uint8_t coverage = text_coverage<Depth, Depth>(row, x);
+        if (coverage) {
+          if (!len) {
+            xs = static_cast<std::uint16_t>(x);
+          }
+          buffer[len++] = color::set_alpha(color, lut[coverage]);
+          if (len < VIC_GPR_SPAN_BUFFER_SIZE) {
+            continue;
+          }
+        }
+        if (len) {
+          text_span({ static_cast<std::int16_t>(origin.x + xs), py }, len, buffer);
+          len = 0U;
+        }
+      }
+      if (len) {
+        text_span({ static_cast<std::int16_t>(origin.x + xs), py }, len, buffer);
+      }
+    }
+  }
+
+
+  /**
+   * Render a subpixel glyph
+   * With a known stripe order the 3x samples are FIR filtered and the pen color is blended per channel
+   * over the read back screen pixels, otherwise the samples of a pixel are averaged to grayscale AA
+   * \param glyph Glyph to render
+   * \param origin Top left screen vertex of the glyph
+   * \param order Stripe order of the screen
+   */
+  void text_glyph_render_subpixel(const font::glyph_type& glyph, vertex_type origin, text_subpixel_type order)
+  {
+    const std::uint16_t count = static_cast<std::uint16_t>(3U * glyph.xsize + 2U * TEXT_SUBPIXEL_PAD);
+    if (count > VIC_TXR_GLYPH_BUFFER_SIZE) {
+      // glyph too wide for the sample buffer
+      return;
+    }
+    const color::value_type color = pen_get_color();
+    const std::uint8_t*     lut   = text_alpha_lut(color::get_alpha(color));
+    const std::int16_t      x0    = (order != text_subpixel_none) ? -1 : 0;   // fringe pixels of the filter
+    const std::int16_t      x1    = static_cast<std::int16_t>(glyph.xsize - 1 - x0);
+    const std::int16_t      width = static_cast<std::int16_t>(screen_width());
+
+    std::uint8_t samples[VIC_TXR_GLYPH_BUFFER_SIZE];
+    for (std::uint16_t i = 0U; i < count; ++i) {
+      samples[i] = 0U;
+    }
+    color::value_type buffer[VIC_GPR_SPAN_BUFFER_SIZE];
+    const std::uint8_t* data = glyph.data;
+    for (std::uint_fast8_t y = 0U; y < glyph.ysize; ++y) {
+      text_subpixel_row(glyph, data, samples);
+      const std::int16_t py = static_cast<std::int16_t>(origin.y + y);
+      if ((py < 0) || (py >= static_cast<std::int16_t>(screen_height()))) {
+        continue;
+      }
+      std::uint16_t len = 0U;
+      std::int16_t  xs  = 0;
+      for (std::int16_t x = x0; x <= x1; ++x) {
+        const std::int16_t px = static_cast<std::int16_t>(origin.x + x);
+        std::uint8_t alpha[3];
+        if ((px >= 0) && (px < width) && text_subpixel_alpha(samples, x, order, lut, alpha)) {
+          if (!len) {
+            xs = x;
+          }
+          buffer[len++] = (order != text_subpixel_none) ? text_subpixel_mix(color, drv_pixel_get({ px, py }), alpha, order, 0xFFU)
+                                                        : color::set_alpha(color, alpha[0]);
+          if (len < VIC_GPR_SPAN_BUFFER_SIZE) {
+            continue;
+          }
+        }
+        if (len) {
+          text_span({ static_cast<std::int16_t>(origin.x + xs), py }, len, buffer);
+          len = 0U;
+        }
+      }
+      if (len) {
+        text_span({ static_cast<std::int16_t>(origin.x + xs), py }, len, buffer);
+      }
+    }
+  }
+
+
+  /**
+   * Decode a row of a subpixel glyph into 8 bit samples
+   * The 3 * xsize samples are stored behind TEXT_SUBPIXEL_PAD samples, the padding on both sides must be cleared
+   * \param glyph Subpixel glyph
+   * \param data Packed row or RLE stream position of the row, advanced to the next row
+   * \param samples Sample buffer of 3 * xsize + 2 * TEXT_SUBPIXEL_PAD samples
+   */
+  static inline void text_subpixel_row(const font::glyph_type& glyph, const std::uint8_t*& data, std::uint8_t* samples)
+  {
+    const std::uint8_t  depth = static_cast<std::uint8_t>(glyph.font->attr & font::AA_MASK);
+    const std::uint8_t  scale = static_cast<std::uint8_t>(255U / ((1U << depth) - 1U));
+    const std::uint16_t count = static_cast<std::uint16_t>(3U * glyph.xsize);
+    samples += TEXT_SUBPIXEL_PAD;
+    if ((glyph.font->attr & font::FORMAT_MASK) == font::FORMAT_RLE) {
+      std::uint16_t length;
+      for (std::uint16_t x = 0U; x < count; ) {
+        const std::uint8_t coverage = static_cast<std::uint8_t>(font::rle_run(data, depth, length) * scale);
+        for (; length && (x < count); --length) {
+          samples[x++] = coverage;
+        }
+      }
+    }
+    else {
+      for (std::uint16_t x = 0U; x < count; ++x) {
+        samples[x] = static_cast<std::uint8_t>(text_pixel(data, x, depth) * scale);
+      }
+      data += glyph.bytes_per_line;
+    }
+  }
+
+
+  /**
+   * Returns the blend weights of a pixel of a subpixel glyph row
+   * With a stripe order each subpixel is filtered by a 5 tap FIR filter (1/9, 2/9, 3/9, 2/9, 1/9) over the
+   * neighboring samples, which spreads the energy and reduces the color fringes. Without the samples are averaged.
+   * \param samples Sample row, see text_subpixel_row()
+   * \param x Glyph x of the pixel, -1 to xsize for the fringe pixels of the filter
+   * \param order Stripe order
+   * \param lut Coverage to alpha LUT
+   * \param alpha Blend weights of the subpixels in stripe order (left to right), only alpha[0] without stripe order
+   * \return False if the pixel isn't covered at all
+   */
+  static inline bool text_subpixel_alpha(const std::uint8_t* samples, std::int16_t x, text_subpixel_type order, const std::uint8_t* lut, std::uint8_t* alpha)
+  {
+    // first tap of the left subpixel of the pixel
+    const std::uint8_t* s = samples + 3 * x + TEXT_SUBPIXEL_PAD - 2;
+    if (order == text_subpixel_none) {
+      alpha[0] = lut[(s[2] + s[3] + s[4] + 1U) / 3U];
+      return alpha[0] != 0U;
+    }
+    for (std::uint_fast8_t c = 0U; c < 3U; ++c, ++s) {
+      // 7282 / 65536 = 1 / 9
+      alpha[c] = lut[((s[0] + 2U * s[1] + 3U * s[2] + 2U * s[3] + s[4]) * 7282UL + 32768UL) >> 16U];
+    }
+    return (alpha[0] | alpha[1] | alpha[2]) != 0U;
+  }
+
+
+  /**
+   * Blend a color per channel over a background color
+   * \param foreground Foreground (pen) color
+   * \param background Background color
+   * \param alpha Blend weights of the subpixels in stripe order (left to right)
+   * \param order Stripe order, text_subpixel_rgb or text_subpixel_bgr
+   * \param a Alpha of the resulting color
+   * \return Blended color
+   */
+  static inline color::value_type text_subpixel_mix(color::value_type foreground, color::value_type background, const std::uint8_t* alpha, text_subpixel_type order, std::uint8_t a)
+  {
+    const std::uint8_t ar = alpha[(order == text_subpixel_rgb) ? 0U : 2U];
+    const std::uint8_t ab = alpha[(order == text_subpixel_rgb) ? 2U : 0U];
+    return color::argb(static_cast<std::uint8_t>((color::get_red(foreground)   * ar       + color::get_red(background)   * (255U - ar)       + 127U) / 255U),
+                       static_cast<std::uint8_t>((color::get_green(foreground) * alpha[1] + color::get_green(background) * (255U - alpha[1]) + 127U) / 255U),
+                       static_cast<std::uint8_t>((color::get_blue(foreground)  * ab       + color::get_blue(background)  * (255U - ab)       + 127U) / 255U),
+                       a);
+  }
+
+
+  // returns the raw coverage of pixel x of a glyph row
+  template<std::uint8_t Storage>
+  static inline std::uint8_t text_pixel(const std::uint8_t* row, std::uint_fast16_t x)
+  {
+    return static_cast<std::uint8_t>((row[(x * Storage) >> 3U] >> (8U - Storage - ((x * Storage) & 0x07U))) & ((1U << Storage) - 1U));
+  }
+
+
+  /**
+   * Returns the coverage of pixel x of a glyph row as 8 bit alpha index
+   * 8 bpp data is the coverage itself and is read directly, lower depths are scaled to 0 - 255
+   * \param Depth Bits per pixel of the glyph
+   * \param Storage Bits per pixel of the glyph data
+   * \param row Glyph row
+   * \param x Pixel in the row
+   * \return Coverage 0 - 255
+   */
+  template<std::uint8_t Depth, std::uint8_t Storage>
+  static inline std::uint8_t text_coverage(const std::uint8_t* row, std::uint_fast16_t x)
+  {
+    return ((Depth == 8U) && (Storage == 8U)) ? row[x] : static_cast<std::uint8_t>(text_pixel<Storage>(row, x) * (255U / ((1U << Depth) - 1U)));
+  }
+
+
+  // returns the raw coverage of pixel x of a glyph row with the given bits per pixel
+  static inline std::uint8_t text_pixel(const std::uint8_t* row, std::uint_fast16_t x, std::uint8_t depth)
+  {
+    return static_cast<std::uint8_t>((row[(x * depth) >> 3U] >> (8U - depth - ((x * depth) & 0x07U))) & ((1U << depth) - 1U));
+  }
+
+
+  /**
+   * Returns true if the glyph data is held expanded (one byte per pixel) after text_glyph_expand()
+   * \param glyph Glyph
+   * \return True for compressed and subpixel glyphs
+   */
+  static inline bool text_glyph_is_expanded(const font::glyph_type& glyph)
+  {
+    return (glyph.font->attr & (font::FORMAT_MASK | font::SUBPIXEL_MASK)) != (font::FORMAT_RAW | font::SUBPIXEL_NONE);
+  }
+
+
+  /**
+   * Expand a compressed (RLE) or subpixel glyph for the renderers which need random access to the glyph pixels
+   * Subpixel glyphs are expanded to grayscale, the samples of a pixel are averaged.
+   * Uncompressed glyphs are left untouched
+   * \param glyph Glyph, changed to the expanded glyph (one byte per pixel)
+   * \param buffer Expansion buffer of VIC_TXR_GLYPH_BUFFER_SIZE bytes
+   * \return false if the glyph is too large for the buffer
+   */
+  inline bool text_glyph_expand(font::glyph_type& glyph, std::uint8_t* buffer) const
+  {
+    if (!text_glyph_is_expanded(glyph)) {
+      return true;
+    }
+    if (glyph.xsize * glyph.ysize > VIC_TXR_GLYPH_BUFFER_SIZE) {
+      return false;
+    }
+    const std::uint8_t* stream = glyph.data;
+    text_glyph_expand_rows(glyph, stream, glyph.ysize, buffer);
+    glyph.data           = buffer;
+    glyph.bytes_per_line = glyph.xsize;
+    return true;
+  }
+
+
+  /**
+   * Expand rows of a compressed (RLE) or subpixel glyph into one byte per pixel
+   * \param glyph Glyph
+   * \param stream Data of the first row to expand, advanced behind the last expanded row
+   * \param rows Count of rows to expand
+   * \param buffer Destination, rows * glyph.xsize bytes
+   */
+  static void text_glyph_expand_rows(const font::glyph_type& glyph, const std::uint8_t*& stream, std::uint16_t rows, std::uint8_t* buffer)
+  {
+    const std::uint8_t depth = static_cast<std::uint8_t>(glyph.font->attr & font::AA_MASK);
+    if (font::samples(*glyph.font) == 1U) {
+      stream = font::rle_expand(stream, depth, static_cast<std::uint16_t>(rows * glyph.xsize), buffer);
+    }
+    else {
+      // RLE glyphs have no bytes per line, the stream position is advanced by the runs
+      const bool          rle      = (glyph.font->attr & font::FORMAT_MASK) == font::FORMAT_RLE;
+      const std::uint8_t* row      = stream;
+      std::uint16_t       length   = 0U;
+      std::uint8_t        coverage = 0U;
+      for (std::uint16_t y = 0U, i = 0U; y < rows; ++y, row += glyph.bytes_per_line) {
+        for (std::uint16_t x = 0U; x < 3U * glyph.xsize; x = static_cast<std::uint16_t>(x + 3U)) {
+          std::uint16_t sum = 0U;
+          for (std::uint_fast8_t c = 0U; c < 3U; ++c) {
+            if (!rle) {
+              sum = static_cast<std::uint16_t>(sum + text_pixel(row, x + c, depth));
+            }
+            else {
+              if (!length) {
+                coverage = font::rle_run(row, depth, length);
+              }
+              --length;
+              sum = static_cast<std::uint16_t>(sum + coverage);
+            }
+          }
+          buffer[i++] = static_cast<std::uint8_t>((sum + 1U) / 3U);
+        }
+      }
+      stream = row;
+    }
+  }
+
+
+  // geometry of a rotated glyph
+  typedef struct tag_text_rotation_type {
+    vertex_type   offset;           // top/left of the rotated glyph box relative to the anchor
+    std::uint16_t width;            // width of the rotated glyph box
+    std::uint16_t height;           // height of the rotated glyph box
+    std::int32_t  a;                // glyph x of the center of box pixel (0,0) in 1/32768 pixel
+    std::int32_t  b;                // glyph y of the center of box pixel (0,0) in 1/32768 pixel
+    std::int32_t  c;                // cos(angle), normalized to 16384
+    std::int32_t  s;                // sin(angle), normalized to 16384
+    bool          quadrant;         // angle is a multiple of 90 degree, glyph pixels map exactly
+  } text_rotation_type;
+
+
+  /**
+   * Render a rotated char
+   * \param ch Char code
+   * \param anchor Screen position of the (unrotated) top/left corner of the char
+   * \param angle Angle in degree, anticlockwise
+   * \param c cos(angle), normalized to 16384
+   * \param s sin(angle), normalized to 16384
+   * \return Char distance (cursor movement along the baseline)
+   */
+  std::uint16_t text_char_rotate(std::uint32_t ch, vertex_type anchor, std::int16_t angle, std::int32_t c, std::int32_t s)
+  {
+    font::glyph_type glyph;
+    if ((ch < 0x20U) || !text_glyph_get(ch, glyph)) {
+      // non or unknown char
+      return 0U;
+    }
+    // compressed glyphs which are too large for the buffer are expanded in strips of rows
+    std::uint8_t buffer[VIC_TXR_GLYPH_BUFFER_SIZE];
+    const bool strips = text_glyph_is_expanded(glyph) && (glyph.xsize * glyph.ysize > VIC_TXR_GLYPH_BUFFER_SIZE);
+    if (!glyph.xsize || !glyph.ysize || (!strips && !text_glyph_expand(glyph, buffer))) {
+      // empty glyph
+      return glyph.xdist;
+    }
+
+    text_rotation_type rot;
+    text_rotation_init(glyph, c, s, rot);
+    const vertex_type origin = { static_cast<std::int16_t>(anchor.x + rot.offset.x), static_cast<std::int16_t>(anchor.y + rot.offset.y) };
+    if (!text_is_visible(origin, { static_cast<std::int16_t>(origin.x + rot.width - 1), static_cast<std::int16_t>(origin.y + rot.height - 1) })) {
+      // glyph is completely off screen or clipped
+      return glyph.xdist;
+    }
+
+    const color::value_type color = pen_get_color();
+    if (strips) {
+      // every pixel of the rotated box samples one glyph pixel, so the strips are rendered one after
+      // the other without overlapping, they are not cached
+      const std::uint16_t strip_rows = static_cast<std::uint16_t>(VIC_TXR_GLYPH_BUFFER_SIZE / glyph.xsize);
+      const std::uint8_t* stream     = glyph.data;
+      font::glyph_type    strip      = glyph;
+      strip.data           = buffer;
+      strip.bytes_per_line = glyph.xsize;
+      for (std::uint16_t y = 0U; y < glyph.ysize; y = static_cast<std::uint16_t>(y + strip_rows)) {
+        strip.ysize = static_cast<std::uint8_t>((glyph.ysize - y) < strip_rows ? (glyph.ysize - y) : strip_rows);
+        text_glyph_expand_rows(glyph, stream, strip.ysize, buffer);
+        text_rotation_type part = rot;
+        part.b -= 32768L * y;   // the strip starts at glyph row y
+        text_rotate_render(strip, part, origin, color);
+      }
+      return glyph.xdist;
+    }
+
+    if (text_cache_) {
+      const glyph_cache::key_type key = { glyph.font, ch, color, 0U, false, angle, 0U };
+      const glyph_cache::entry_type* entry = text_cache_->find(key);
+      if (!entry) {
+        // cache miss, render the rotated glyph into a new slot
+        glyph_cache::entry_type* slot = text_cache_->insert(key, rot.width, rot.height);
+        if (slot) {
+          for (std::uint16_t y = 0U; y < rot.height; ++y) {
+            text_rotate_row(glyph, rot, y, 0U, rot.width, color, slot->data + y * rot.width);
+          }
+          entry = slot;
+        }
+      }
+      if (entry) {
+        text_glyph_render_cached(*entry, origin);
+        return glyph.xdist;
+      }
+    }
+
+    text_rotate_render(glyph, rot, origin, color);
+    return glyph.xdist;
+  }
+
+
+  /**
+   * Render the rotated box of a glyph, runs of covered pixels are output as color spans
+   * \param glyph Glyph to render
+   * \param rot Rotation geometry
+   * \param origin Top left screen vertex of the rotated box
+   * \param color Pen color
+   */
+  void text_rotate_render(const font::glyph_type& glyph, const text_rotation_type& rot, vertex_type origin, color::value_type color)
+  {
+    color::value_type span[VIC_GPR_SPAN_BUFFER_SIZE];
+    for (std::uint16_t y = 0U; y < rot.height; ++y) {
+      const std::int16_t py = static_cast<std::int16_t>(origin.y + y);
+      if ((py < 0) || (py >= static_cast<std::int16_t>(screen_height()))) {
+        continue;
+      }
+      for (std::uint16_t x = 0U; x < rot.width; ) {
+        const std::uint16_t len = (static_cast<std::uint16_t>(rot.width - x) < VIC_GPR_SPAN_BUFFER_SIZE) ? static_cast<std::uint16_t>(rot.width - x) : static_cast<std::uint16_t>(VIC_GPR_SPAN_BUFFER_SIZE);
+        text_rotate_row(glyph, rot, y, x, len, color, span);
+        text_span_runs({ static_cast<std::int16_t>(origin.x + x), py }, span, len);
+        x = static_cast<std::uint16_t>(x + len);
+      }
+    }
+  }
+
+
+  /**
+   * Calculate the box and the sampling start of a rotated glyph
+   * \param glyph Glyph to rotate
+   * \param c cos(angle), normalized to 16384
+   * \param s sin(angle), normalized to 16384
+   * \param rot Rotation geometry
+   */
+  static void text_rotation_init(const font::glyph_type& glyph, std::int32_t c, std::int32_t s, text_rotation_type& rot)
+  {
+    // rotate the corners of the glyph box, screen = (x * c + y * s, y * c - x * s)
+    std::int32_t xmin = 0x7FFFFFFFL, xmax = -0x7FFFFFFFL, ymin = 0x7FFFFFFFL, ymax = -0x7FFFFFFFL;
+    for (std::uint_fast8_t i = 0U; i < 4U; ++i) {
+      const std::int32_t x  = glyph.xpos + ((i & 0x01U) ? glyph.xsize : 0);
+      const std::int32_t y  = glyph.ypos + ((i & 0x02U) ? glyph.ysize : 0);
+      const std::int32_t sx = x * c + y * s;
+      const std::int32_t sy = y * c - x * s;
+      xmin = sx < xmin ? sx : xmin; xmax = sx > xmax ? sx : xmax;
+      ymin = sy < ymin ? sy : ymin; ymax = sy > ymax ? sy : ymax;
+    }
+    rot.offset.x = static_cast<std::int16_t>(text_floor_div(xmin, 16384L));
+    rot.offset.y = static_cast<std::int16_t>(text_floor_div(ymin, 16384L));
+    rot.width    = static_cast<std::uint16_t>(-text_floor_div(-xmax, 16384L) - rot.offset.x);
+    rot.height   = static_cast<std::uint16_t>(-text_floor_div(-ymax, 16384L) - rot.offset.y);
+    rot.c        = c;
+    rot.s        = s;
+    rot.quadrant = !c || !s;
+
+    // inverse rotation of the center of box pixel (0,0): glyph = (x * c - y * s, x * s + y * c)
+    const std::int32_t x2 = 2 * rot.offset.x + 1;
+    const std::int32_t y2 = 2 * rot.offset.y + 1;
+    rot.a = x2 * c - y2 * s - 2L * 16384L * glyph.xpos;
+    rot.b = x2 * s + y2 * c - 2L * 16384L * glyph.ypos;
+  }
+
+
+  // floor division, rounding towards negative infinity
+  static inline std::int32_t text_floor_div(std::int32_t a, std::int32_t b)
+  {
+    return (a >= 0) ? (a / b) : -((-a + b - 1) / b);
+  }
+
+
+  // render a part of a row of the rotated glyph box, dispatched by font depth
+  inline void text_rotate_row(const font::glyph_type& glyph, const text_rotation_type& rot, std::uint16_t y, std::uint16_t x, std::uint16_t length,
+                              color::value_type color, color::value_type* dst)
+  {
+    const bool expanded = text_glyph_is_expanded(glyph);
+    switch (glyph.font->attr & font::AA_MASK) {
+      case font::AA_NONE : expanded ? text_rotate_row<1U, 8U>(glyph, rot, y, x, length, color, dst) : text_rotate_row<1U, 1U>(glyph, rot, y, x, length, color, dst); break;
+      case font::AA_2    : expanded ? text_rotate_row<2U, 8U>(glyph, rot, y, x, length, color, dst) : text_rotate_row<2U, 2U>(glyph, rot, y, x, length, color, dst); break;
+      case font::AA_4    : expanded ? text_rotate_row<4U, 8U>(glyph, rot, y, x, length, color, dst) : text_rotate_row<4U, 4U>(glyph, rot, y, x, length, color, dst); break;
+      case font::AA_8    : text_rotate_row<8U, 8U>(glyph, rot, y, x, length, color, dst); break;
+      default            : break;
+    }
+  }
+
+
+  /**
+   * Render a part of a row of the rotated glyph box, uncovered pixels are set to 0
+   * Multiples of 90 degree read the glyph transposed/reversed in whole pixel steps, all other
+   * angles sample the glyph (nearest pixel) with incremental fixed point coordinates
+   * \param Depth Bits per pixel of the glyph (1, 2, 4 or 8)
+   * \param Storage Bits per pixel of the glyph data (Depth, or 8 for expanded RLE and subpixel glyphs)
+   * \param glyph Glyph to render
+   * \param rot Rotation geometry
+   * \param y Row of the rotated box
+   * \param x First column of the rotated box
+   * \param length Count of pixels to render
+   * \param color Pen color
+   * \param dst Destination pixels
+   */
+  template<std::uint8_t Depth, std::uint8_t Storage>
+  void text_rotate_row(const font::glyph_type& glyph, const text_rotation_type& rot, std::uint16_t y, std::uint16_t x, std::uint16_t length,
+                       color::value_type color, color::value_type* dst)
+  {
+    const std::uint8_t* lut = text_alpha_lut(color::get_alpha(color));
+
+    // glyph coordinates of the first pixel in 1/32768 pixel
+    std::int32_t a = rot.a + 2L * (x * rot.c - y * rot.s);
+    std::int32_t b = rot.b + 2L * (x * rot.s + y * rot.c);
+
+    if (rot.quadrant) {
+      // transposed read, the glyph coordinates step by -1, 0 or 1 pixel
+      std::int16_t gx = static_cast<std::int16_t>(text_floor_div(a, 32768L));
+      std::int16_t gy = static_cast<std::int16_t>(text_floor_div(b, 32768L));
+      const std::int16_t ux = static_cast<std::int16_t>(rot.c / 16384L);
+      const std::int16_t uy = static_cast<std::int16_t>(rot.s / 16384L);
+      for (; length; --length, gx = static_cast<std::int16_t>(gx + ux), gy = static_cast<std::int16_t>(gy + uy)) {
+        std::uint8_t coverage = 0U;
+        if ((gx >= 0) && (gx < glyph.xsize) && (gy >= 0) && (gy < glyph.ysize)) {
+          coverage = text_coverage<Depth, Storage>(glyph.data + gy * glyph.bytes_per_line, gx);
+        }
+        *dst++ = coverage ? color::set_alpha(color, lut[coverage]) : 0U;
+      }
+      return;
+    }
+
+    for (; length; --length, a += 2L * rot.c, b += 2L * rot.s) {
+      std::uint8_t coverage = 0U;
+      if ((a >= 0) && (b >= 0)) {
+        const std::int32_t gx = a >> 15U;
+        const std::int32_t gy = b >> 15U;
+        if ((gx < glyph.xsize) && (gy < glyph.ysize)) {
+          coverage = text_coverage<Depth, Storage>(glyph.data + gy * glyph.bytes_per_line, gx);
+        }
+      }
+      *dst++ = coverage ? color::set_alpha(color, lut[coverage]) : 0U;
+    }
+  }
+
+
+  // output the runs of covered (non zero) pixels of a row
+  inline void text_span_runs(vertex_type start, const color::value_type* row, std::uint16_t length)
+  {
+    for (std::uint16_t x = 0U; x < length; ) {
+      if (!row[x]) {
+        ++x;
+        continue;
+      }
+      const std::uint16_t xs = x;
+      while ((++x < length) && row[x]) { }
+      text_span({ static_cast<std::int16_t>(start.x + xs), start.y }, static_cast<std::uint16_t>(x - xs), &row[xs]);
+    }
+  }
+
+
+  // decode a glyph into ARGB pixels, dispatched by font depth
+  inline void text_glyph_decode(const font::glyph_type& glyph, color::value_type color, color::value_type* dst)
+  {
+    const bool expanded = text_glyph_is_expanded(glyph);
+    switch (glyph.font->attr & font::AA_MASK) {
+      case font::AA_NONE : expanded ? text_glyph_decode<1U, 8U>(glyph, color, dst) : text_glyph_decode<1U, 1U>(glyph, color, dst); break;
+      case font::AA_2    : expanded ? text_glyph_decode<2U, 8U>(glyph, color, dst) : text_glyph_decode<2U, 2U>(glyph, color, dst); break;
+      case font::AA_4    : expanded ? text_glyph_decode<4U, 8U>(glyph, color, dst) : text_glyph_decode<4U, 4U>(glyph, color, dst); break;
+      case font::AA_8    : text_glyph_decode<8U, 8U>(glyph, color, dst); break;
+      default            : break;
+    }
+  }
+
+
+  /**
+   * Decode a glyph into ARGB pixels, uncovered pixels are set to 0
+   * \param Depth Bits per pixel of the glyph (1, 2, 4 or 8)
+   * \param Storage Bits per pixel of the glyph data (Depth, or 8 for expanded RLE and subpixel glyphs)
+   * \param glyph Glyph to decode
+   * \param color Pen color
+   * \param dst Destination, glyph.xsize * glyph.ysize pixels
+   */
+  template<std::uint8_t Depth, std::uint8_t Storage>
+  void text_glyph_decode(const font::glyph_type& glyph, color::value_type color, color::value_type* dst)
+  {
+    const std::uint8_t* lut = text_alpha_lut(color::get_alpha(color));
+
+    const std::uint8_t* row = glyph.data;
+    for (std::uint_fast8_t y = 0U; y < glyph.ysize; ++y, row += glyph.bytes_per_line) {
+      for (std::uint_fast16_t x = 0U; x < glyph.xsize; ++x) {
+        const std::uint8_t coverage = text_coverage<Depth, Storage>(row, x);
+        *dst++ = coverage ? color::set_alpha(color, lut[coverage]) : 0U;
+      }
+    }
+  }
+
+
+  /**
+   * Render a cached glyph, runs of covered pixels are passed directly out of the cache
+   * \param entry Cache entry of the glyph
+   * \param origin Top left screen vertex of the glyph
+   */
+  void text_glyph_render_cached(const glyph_cache::entry_type& entry, vertex_type origin)
+  {
+    const color::value_type* row = entry.data;
+    for (std::uint_fast8_t y = 0U; y < entry.height; ++y, row += entry.width) {
+      const std::int16_t py = static_cast<std::int16_t>(origin.y + y);
+      if ((py < 0) || (py >= static_cast<std::int16_t>(screen_height()))) {
+        continue;
+      }
+      text_span_runs({ origin.x, py }, row, entry.width);
+    }
+  }
+
+
+  /**
+   * Render the opaque char cell of a glyph
+   * The cell spans the font height and the char distance (or the glyph, if it exceeds the distance)
+   * \param ch Char code
+   * \param glyph Glyph of the char
+   */
+  void text_cell_render(std::uint32_t ch, font::glyph_type glyph)
+  {
+    // subpixel rendered glyphs and compressed glyphs which are too large for the buffer are decoded row by row
+    // into the buffer, other glyphs are expanded if needed
+    const text_subpixel_type order  = text_subpixel_get(glyph);
+    const bool               by_row = (order == text_subpixel_none) && text_glyph_is_expanded(glyph) && (glyph.xsize * glyph.ysize > VIC_TXR_GLYPH_BUFFER_SIZE);
+    std::uint8_t pixels[VIC_TXR_GLYPH_BUFFER_SIZE];
+    if ((order != text_subpixel_none) ? (3U * glyph.xsize + 2U * TEXT_SUBPIXEL_PAD > VIC_TXR_GLYPH_BUFFER_SIZE) : (!by_row && !text_glyph_expand(glyph, pixels))) {
+      // glyph too large, render the empty cell
+      glyph.ysize = 0U;
+    }
+    for (std::uint16_t i = 0U; (order != text_subpixel_none) && (i < 3U * glyph.xsize + 2U * TEXT_SUBPIXEL_PAD); ++i) {
+      pixels[i] = 0U;
+    }
+    const font::glyph_type coded = glyph;
+    if (by_row) {
+      // every glyph row is expanded to the buffer start
+      glyph.data           = pixels;
+      glyph.bytes_per_line = 0U;
+    }
+    const std::uint8_t* data = coded.data;
+
+    // cell extent relative to the cursor
+    const std::int16_t  cx0    = glyph.xpos < 0 ? glyph.xpos : 0;
+    const std::int16_t  cx1    = (glyph.xpos + glyph.xsize > glyph.xdist) ? static_cast<std::int16_t>(glyph.xpos + glyph.xsize) : static_cast<std::int16_t>(glyph.xdist);
+    const std::uint16_t width  = static_cast<std::uint16_t>(cx1 - cx0);
+    const std::uint16_t height = text_font_->ysize;
+    const vertex_type   origin = { static_cast<std::int16_t>(text_x_act_ + cx0), text_y_act_ };
+    const vertex_type   offset = { static_cast<std::int16_t>(glyph.xpos - cx0), glyph.ypos };   // glyph position in the cell
+    text_x_act_ += glyph.xdist;
+
+    if (!width || !height ||
+        !text_is_visible(origin, { static_cast<std::int16_t>(origin.x + width - 1), static_cast<std::int16_t>(origin.y + height - 1) })) {
+      // cell is empty, completely off screen or clipped
+      return;
+    }
+
+    const bool              inverse    = (text_mode_ == text_mode_inverse);
+    const color::value_type foreground = inverse ? bg_get_color()  : pen_get_color();
+    const color::value_type background = inverse ? pen_get_color() : bg_get_color();
+
+    if (text_cache_) {
+      const glyph_cache::key_type key = { glyph.font, ch, foreground, background, true, 0, static_cast<std::uint8_t>(order) };
+      const glyph_cache::entry_type* entry = text_cache_->find(key);
+      if (!entry) {
+        // cache miss, render the cell into a new slot
+        glyph_cache::entry_type* slot = text_cache_->insert(key, width, height);
+        if (slot) {
+          for (std::uint16_t y = 0U; y < height; ++y) {
+            text_cell_samples(coded, offset, y, order, by_row, data, pixels);
+            text_cell_row(glyph, offset, y, 0U, width, foreground, background, order, pixels, slot->data + y * width);
+          }
+          entry = slot;
+        }
+      }
+      if (entry) {
+        // every cell row is one span out of the cache
+        for (std::uint16_t y = 0U; y < height; ++y) {
+          const std::int16_t py = static_cast<std::int16_t>(origin.y + y);
+          if ((py >= 0) && (py < static_cast<std::int16_t>(screen_height()))) {
+            text_span({ origin.x, py }, width, entry->data + y * width);
+          }
+        }
+        return;
+      }
+    }
+
+    color::value_type buffer[VIC_GPR_SPAN_BUFFER_SIZE];
+    for (std::uint16_t y = 0U; y < height; ++y) {
+      text_cell_samples(coded, offset, y, order, by_row, data, pixels);
+      const std::int16_t py = static_cast<std::int16_t>(origin.y + y);
+      if ((py < 0) || (py >= static_cast<std::int16_t>(screen_height()))) {
+        continue;
+      }
+      for (std::uint16_t x = 0U; x < width; ) {
+        const std::uint16_t len = (static_cast<std::uint16_t>(width - x) < VIC_GPR_SPAN_BUFFER_SIZE) ? static_cast<std::uint16_t>(width - x) : static_cast<std::uint16_t>(VIC_GPR_SPAN_BUFFER_SIZE);
+        text_cell_row(glyph, offset, y, x, len, foreground, background, order, pixels, buffer);
+        text_span({ static_cast<std::int16_t>(origin.x + x), py }, len, buffer);
+        x = static_cast<std::uint16_t>(x + len);
+      }
+    }
+  }
+
+
+  // decode the sample row of a subpixel rendered glyph or the pixel row of a glyph decoded by row for cell row y,
+  // rows must be passed in ascending order
+  static inline void text_cell_samples(const font::glyph_type& glyph, vertex_type offset, std::uint16_t y, text_subpixel_type order,
+                                       bool by_row, const std::uint8_t*& data, std::uint8_t* samples)
+  {
+    const std::int16_t gy = static_cast<std::int16_t>(y - offset.y);
+    if ((gy < 0) || (gy >= glyph.ysize)) {
+      return;
+    }
+    if (order != text_subpixel_none) {
+      text_subpixel_row(glyph, data, samples);
+    }
+    else if (by_row) {
+      text_glyph_expand_rows(glyph, data, 1U, samples);
+    }
+  }
+
+
+  // render a part of a cell row, dispatched by font depth
+  inline void text_cell_row(const font::glyph_type& glyph, vertex_type offset, std::uint16_t y, std::uint16_t x, std::uint16_t length,
+                            color::value_type foreground, color::value_type background, text_subpixel_type order, const std::uint8_t* samples,
+                            color::value_type* dst)
+  {
+    if (order != text_subpixel_none) {
+      text_cell_row_subpixel(glyph, offset, y, x, length, foreground, background, order, samples, dst);
+      return;
+    }
+    const bool expanded = text_glyph_is_expanded(glyph);
+    switch (glyph.font->attr & font::AA_MASK) {
+      case font::AA_NONE : expanded ? text_cell_row<1U, 8U>(glyph, offset, y, x, length, foreground, background, dst) : text_cell_row<1U, 1U>(glyph, offset, y, x, length, foreground, background, dst); break;
+      case font::AA_2    : expanded ? text_cell_row<2U, 8U>(glyph, offset, y, x, length, foreground, background, dst) : text_cell_row<2U, 2U>(glyph, offset, y, x, length, foreground, background, dst); break;
+      case font::AA_4    : expanded ? text_cell_row<4U, 8U>(glyph, offset, y, x, length, foreground, background, dst) : text_cell_row<4U, 4U>(glyph, offset, y, x, length, foreground, background, dst); break;
+      case font::AA_8    : text_cell_row<8U, 8U>(glyph, offset, y, x, length, foreground, background, dst); break;
+      default            : break;
+    }
+  }
+
+
+  /**
+   * Render a part of a cell row, the glyph coverage blends foreground over background
+   * \param Depth Bits per pixel of the glyph (1, 2, 4 or 8)
+   * \param Storage Bits per pixel of the glyph data (Depth, or 8 for expanded RLE and subpixel glyphs)
+   * \param glyph Glyph of the cell
+   * \param offset Glyph position in the cell
+   * \param y Cell row
+   * \param x First cell column
+   * \param length Count of pixels to render
+   * \param foreground Glyph color
+   * \param background Cell background color
+   * \param dst Destination pixels
+   */
+  template<std::uint8_t Depth, std::uint8_t Storage>
+  void text_cell_row(const font::glyph_type& glyph, vertex_type offset, std::uint16_t y, std::uint16_t x, std::uint16_t length,
+                     color::value_type foreground, color::value_type background, color::value_type* dst)
+  {
+    const std::uint8_t* lut = text_alpha_lut(color::get_alpha(foreground));
+
+    const std::int16_t gy = static_cast<std::int16_t>(y - offset.y);
+    if ((gy < 0) || (gy >= glyph.ysize)) {
+      // row is outside the glyph
+      for (; length; --length) {
+        *dst++ = background;
+      }
+      return;
+    }
+    const std::uint8_t* row = glyph.data + gy * glyph.bytes_per_line;
+    for (std::int16_t gx = static_cast<std::int16_t>(x - offset.x); length; --length, ++gx) {
+      std::uint8_t coverage = 0U;
+      if ((gx >= 0) && (gx < glyph.xsize)) {
+        coverage = text_coverage<Depth, Storage>(row, gx);
+      }
+      // mix keeps the background alpha
+      *dst++ = coverage ? color::mix(foreground & 0x00FFFFFFUL, background, lut[coverage]) : background;
+    }
+  }
+
+
+  /**
+   * Render a part of a cell row of a subpixel rendered glyph, the foreground is blended per channel over the background
+   * \param glyph Glyph of the cell
+   * \param offset Glyph position in the cell
+   * \param y Cell row
+   * \param x First cell column
+   * \param length Count of pixels to render
+   * \param foreground Glyph color
+   * \param background Cell background color
+   * \param order Stripe order
+   * \param samples Sample row of the glyph row, see text_cell_samples()
+   * \param dst Destination pixels
+   */
+  void text_cell_row_subpixel(const font::glyph_type& glyph, vertex_type offset, std::uint16_t y, std::uint16_t x, std::uint16_t length,
+                              color::value_type foreground, color::value_type background, text_subpixel_type order, const std::uint8_t* samples,
+                              color::value_type* dst)
+  {
+    const std::uint8_t* lut    = text_alpha_lut(color::get_alpha(foreground));
+    const std::int16_t  gy     = static_cast<std::int16_t>(y - offset.y);
+    const bool          inside = (gy >= 0) && (gy < glyph.ysize);
+    for (std::int16_t gx = static_cast<std::int16_t>(x - offset.x); length; --length, ++gx) {
+      std::uint8_t alpha[3];
+      // mix keeps the background alpha
+      *dst++ = (inside && (gx >= -1) && (gx <= glyph.xsize) && text_subpixel_alpha(samples, gx, order, lut, alpha)) ?
+               text_subpixel_mix(foreground, background, alpha, order, color::get_alpha(background)) : background;
+    }
+  }
+
+
+  static const std::int16_t TEXT_SUBPIXEL_PAD = 5;  // cleared samples on both sides of a subpixel sample row (fringe pixel + filter taps)
+
+  // large compressed glyphs are expanded in strips of rows, so the buffer must hold at least one row
+  static_assert(VIC_TXR_GLYPH_BUFFER_SIZE >= 255U, "VIC_TXR_GLYPH_BUFFER_SIZE must hold a glyph row of 255 pixels");
+
+  glyph_cache*            text_cache_;            // glyph cache, nullptr if not used
+  std::uint8_t            text_alpha_lut_[256];   // coverage to alpha LUT
+  std::uint16_t           text_alpha_lut_alpha_;  // pen alpha of the LUT, > 255 = not built
+  const std::uint8_t*     text_alpha_lut_gamma_;  // gamma LUT the LUT is built with
+
   // non copyable
   const txr& operator=(const txr& rhs)
   { return rhs; }
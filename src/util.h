@@ -151,6 +151,85 @@ inline std::uint8_t byte_reverse(std::uint8_t data)
 }
 
 
+///////////////////////////////////////////////////////////////////////////////
+// 8x8 bit matrix (SWAR) functions
+// An 8x8 monochrome block is kept in an uint64, row y is byte y (bits 8*y .. 8*y+7),
+// pixel x of a row is bit x (LSB is x = 0)
+
+/**
+ * Load an 8x8 bit block out of 8 row bytes
+ * \param rows Row bytes, row 0 first
+ * \param count Number of available rows, missing rows are 0
+ * \return Block
+ */
+inline std::uint64_t bit_load_8x8(const std::uint8_t* rows, std::size_t count = 8U)
+{
+  std::uint64_t block = 0U;
+  for (std::size_t y = (count < 8U ? count : 8U); y > 0U; --y) {
+    block = (block << 8U) | rows[y - 1U];
+  }
+  return block;
+}
+
+
+/**
+ * Store an 8x8 bit block in 8 row bytes
+ * \param rows Row bytes, row 0 first
+ * \param block Block
+ * \param count Number of rows to store
+ */
+inline void bit_store_8x8(std::uint8_t* rows, std::uint64_t block, std::size_t count = 8U)
+{
+  for (std::size_t y = 0U; y < count && y < 8U; ++y, block >>= 8U) {
+    rows[y] = static_cast<std::uint8_t>(block);
+  }
+}
+
+
+/**
+ * Transpose an 8x8 bit block, pixel (x,y) becomes pixel (y,x)
+ * Hacker's Delight transpose8, 3 swap steps on the whole block
+ * \param block Block
+ * \return Transposed block
+ */
+inline std::uint64_t bit_transpose_8x8(std::uint64_t block)
+{
+  std::uint64_t t;
+  t = (block ^ (block >>  7U)) & 0x00AA00AA00AA00AAULL; block = block ^ t ^ (t <<  7U);
+  t = (block ^ (block >> 14U)) & 0x0000CCCC0000CCCCULL; block = block ^ t ^ (t << 14U);
+  t = (block ^ (block >> 28U)) & 0x00000000F0F0F0F0ULL; block = block ^ t ^ (t << 28U);
+  return block;
+}
+
+
+/**
+ * Mirror an 8x8 bit block horizontally, pixel (x,y) becomes pixel (7-x,y)
+ * This is a byte_reverse() of all rows at once
+ * \param block Block
+ * \return Mirrored block
+ */
+inline std::uint64_t bit_mirror_8x8(std::uint64_t block)
+{
+  block = ((block >> 1U) & 0x5555555555555555ULL) | ((block & 0x5555555555555555ULL) << 1U);
+  block = ((block >> 2U) & 0x3333333333333333ULL) | ((block & 0x3333333333333333ULL) << 2U);
+  block = ((block >> 4U) & 0x0F0F0F0F0F0F0F0FULL) | ((block & 0x0F0F0F0F0F0F0F0FULL) << 4U);
+  return block;
+}
+
+
+/**
+ * Flip an 8x8 bit block vertically, pixel (x,y) becomes pixel (x,7-y)
+ * \param block Block
+ * \return Flipped block
+ */
+inline std::uint64_t bit_flip_8x8(std::uint64_t block)
+{
+  block = ((block >>  8U) & 0x00FF00FF00FF00FFULL) | ((block & 0x00FF00FF00FF00FFULL) <<  8U);
+  block = ((block >> 16U) & 0x0000FFFF0000FFFFULL) | ((block & 0x0000FFFF0000FFFFULL) << 16U);
+  return (block >> 32U) | (block << 32U);
+}
+
+
 /**
  * Calculate the squared distance between two vertices
  * \param a Vertex a
@@ -180,7 +259,7 @@ inline std::int16_t orient_2d(vertex_type a, vertex_type b, vertex_type c)
  * \param angle Angle in degree
  * \return sin(x) * 16384
  */
-std::int16_t sin(std::int16_t angle)
+inline std::int16_t sin(std::int16_t angle)
 {
   static const std::int16_t sin90[90] = {
         0,   286,   572,   857,  1143,  1428,  1713,  1997,  2280,  2563,
@@ -219,6 +298,59 @@ inline std::int16_t cos(std::int16_t angle)
 }
 
 
+/**
+ * Helper function to calculate log2(x) in 16.16 fixed point
+ * \param x Value, must be > 0
+ * \return log2(x) * 65536
+ */
+inline std::int32_t log2_q16(std::uint32_t x)
+{
+  // normalize the mantissa to [1, 2) in Q30
+  std::uint64_t m = static_cast<std::uint64_t>(x) << 30U;
+  std::int32_t  n = 0;
+  for (; m >= (2ULL << 30U); m >>= 1U) {
+    ++n;
+  }
+  // fraction bits by repeated squaring of the mantissa
+  std::int32_t frac = 0;
+  for (std::int_fast8_t i = 15; i >= 0; --i) {
+    m = (m * m) >> 30U;
+    if (m >= (2ULL << 30U)) {
+      m >>= 1U;
+      frac |= 1L << i;
+    }
+  }
+  return n * 65536L + frac;
+}
+
+
+/**
+ * Helper function to calculate 2^y of a 16.16 fixed point value
+ * \param y Exponent * 65536, must be < 14 * 65536
+ * \return 2^y * 65536
+ */
+inline std::uint32_t exp2_q16(std::int32_t y)
+{
+  // 2^(2^-k) in Q30
+  static const std::uint32_t root[16] = {
+    1518500250UL, 1276901417UL, 1170923762UL, 1121280436UL, 1097253708UL, 1085434106UL, 1079572136UL, 1076653033UL,
+    1075196443UL, 1074468888UL, 1074105294UL, 1073923544UL, 1073832680UL, 1073787251UL, 1073764537UL, 1073753181UL
+  };
+
+  const std::int32_t  n    = (y >= 0) ? (y >> 16) : -((-y + 65535L) >> 16);   // floor
+  const std::uint32_t frac = static_cast<std::uint32_t>(y - n * 65536L);
+  std::uint64_t r = 1ULL << 30U;
+  for (std::uint_fast8_t k = 0U; k < 16U; ++k) {
+    if (frac & (0x8000U >> k)) {
+      r = (r * root[k]) >> 30U;
+    }
+  }
+  // scale Q30 to Q16 by 2^n
+  const std::int32_t shift = 14 - n;
+  return (shift >= 32) ? 0U : static_cast<std::uint32_t>((r + (1ULL << (shift - 1))) >> shift);
+}
+
+
 /**
  * Helper function to rotate a vertex of a given angle in respect to given center
  * \param point Vertex to rotate
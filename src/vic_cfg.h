@@ -36,5 +36,51 @@
 // increase this value
 #define VIC_GPR_FILL_STACK_SIZE   64
 
+// defines the size (in pixel) of the span buffer which is used by the blitter to convert
+// image rows into the internal ARGB format, the buffer is allocated on the cpu stack
+// (4 bytes per pixel) for the runtime of the blitter function
+#define VIC_GPR_SPAN_BUFFER_SIZE  32
+
+// defines the max. count of char ranges of a prop/UNICODE font which are held in the sorted
+// glyph index of the text renderer (12 bytes per range on 32 bit targets, plus a 96 bytes
+// direct table for ASCII). Ranges beyond this count are still found, but by a linear search
+#define VIC_FONT_INDEX_RANGES     64
+
+// defines the max. count of fonts of a font set (fallback chain), every font takes a glyph index
+#define VIC_FONT_SET_SIZE         4
+
+// defines the count of entries of the char to font resolution cache of a font set, must be a power of 2
+// (8 bytes per entry)
+#define VIC_FONT_SET_CACHE        64
+
+// defines the size (in pixel) of the glyph buffer which is used to expand compressed (RLE)
+// glyphs for cached, opaque and rotated text, the buffer is allocated on the cpu stack
+// (1 byte per pixel). Larger compressed glyphs are not cached, opaque and rotated text
+// expands them in strips of rows, so the buffer must hold at least 255 bytes (one row).
+// The buffer also holds a sample row of subpixel glyphs (3 bytes per pixel + 10), wider
+// subpixel glyphs are not rendered
+#define VIC_TXR_GLYPH_BUFFER_SIZE 512
+
+// defines the size (in bytes) of the buffer which is used by the multihead driver to pass the
+// substrings of a text line to its text heads, the buffer is allocated on the cpu stack,
+// longer substrings are passed in chunks
+#define VIC_DRV_MULTIHEAD_TEXT_BUFFER_SIZE  32
+
+// defines the count of worker threads (POSIX threads) which init and present the heads of the
+// multihead and mirror drivers concurrently, use this if the heads are on independent buses
+// 0 disables the worker pool, the heads are handled one after the other (e.g. on bare-metal targets)
+#define VIC_WORKER_POOL_THREADS   0
+
+// defines if the pipeline driver transfers the presented frames to its head by a flusher thread
+// (POSIX thread), so rendering and bus transfer overlap
+// 0 disables the thread, the frames are transferred by present or by the application (e.g. on bare-metal targets)
+#define VIC_DRV_PIPELINE_THREAD   0
+
+// defines the size (in bytes) of the transaction buffer of heads on a device interface (SPI, I2C, UART)
+// consecutive writes to the same register are coalesced and passed as one burst to io::dev::write,
+// the buffer is flushed if it's full, on present and before delays and reads. The buffer is a member
+// of every head which uses it. 0 disables buffering, every write is passed directly
+#define VIC_IO_TRANSACTION_BUFFER_SIZE  64
+
 
 #endif  // _VIC_CFG_H_
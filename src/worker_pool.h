@@ -0,0 +1,250 @@
+///////////////////////////////////////////////////////////////////////////////
+// \author (c) Marco Paland (info@paland.com)
+//             2017-2017, PALANDesign Hannover, Germany
+//
+// \license The MIT License (MIT)
+//
+// This file is part of the vic library.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// \brief Worker pool for heads on independent buses
+// The multihead and mirror drivers init and present their heads as jobs of the pool,
+// so the bus transfers of heads on separate SPI/I2C buses overlap. The calling thread
+// takes part in the jobs and the pool joins them before run() returns.
+// The pool uses POSIX threads and is only built if VIC_WORKER_POOL_THREADS is > 0 in
+// vic_cfg.h, otherwise the jobs are run one after the other by the calling thread.
+// A job may call run() again (like a mirror of multiheads), such nested jobs are run one
+// after the other by the thread of the job.
+// Heads sharing one bus (or any other state) must not be used with the pool.
+//
+// Usage:
+// static void job(void* context, std::size_t index) { ... }
+// vic::worker_pool::run(8U, &job, &context);     // runs job(context, 0..7)
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _VIC_WORKER_POOL_H_
+#define _VIC_WORKER_POOL_H_
+
+#include <cstdint>
+#include <cstddef>
+
+#include "vic_cfg.h"
+
+#if (VIC_WORKER_POOL_THREADS > 0)
+#include <pthread.h>
+#endif
+
+
+namespace vic {
+
+
+class worker_pool
+{
+public:
+
+  // job function, called with the run() context and the job index
+  typedef void (*job_type)(void* context, std::size_t index);
+
+
+  /**
+   * Run jobs and wait until all of them are done
+   * \param count Number of jobs, the job is called with the indices 0 to count - 1
+   * \param job Job function
+   * \param context Context which is passed to the job function
+   */
+  static void run(std::size_t count, job_type job, void* context)
+  {
+#if (VIC_WORKER_POOL_THREADS > 0)
+    if ((count > 1U) && !instance().is_nested()) {
+      instance().dispatch(count, job, context);
+      return;
+    }
+#endif
+    for (std::size_t i = 0U; i < count; ++i) {
+      job(context, i);
+    }
+  }
+
+
+  /**
+   * Create the pool, the drivers which use the pool call this in their ctor
+   * Static objects are destroyed in reverse order of their construction, so the pool outlives
+   * the drivers, which present their heads in their dtor
+   */
+  static void create()
+  {
+#if (VIC_WORKER_POOL_THREADS > 0)
+    instance();
+#endif
+  }
+
+
+#if (VIC_WORKER_POOL_THREADS > 0)
+private:
+
+  worker_pool()
+    : job_(nullptr)
+    , context_(nullptr)
+    , count_(0U)
+    , next_(0U)
+    , done_(0U)
+    , generation_(0U)
+    , threads_(0U)
+    , stop_(false)
+    , running_(false)
+  {
+    pthread_mutex_init(&run_mutex_, nullptr);
+    pthread_mutex_init(&mutex_, nullptr);
+    pthread_cond_init(&work_cond_, nullptr);
+    pthread_cond_init(&done_cond_, nullptr);
+
+    // start the workers, if a thread can't be created the pool runs with less workers
+    for (; threads_ < VIC_WORKER_POOL_THREADS; ++threads_) {
+      if (pthread_create(&thread_[threads_], nullptr, &worker_pool::worker, this)) {
+        break;
+      }
+    }
+  }
+
+
+  ~worker_pool()
+  {
+    pthread_mutex_lock(&mutex_);
+    stop_ = true;
+    pthread_cond_broadcast(&work_cond_);
+    pthread_mutex_unlock(&mutex_);
+    for (std::size_t i = 0U; i < threads_; ++i) {
+      pthread_join(thread_[i], nullptr);
+    }
+    pthread_cond_destroy(&done_cond_);
+    pthread_cond_destroy(&work_cond_);
+    pthread_mutex_destroy(&mutex_);
+    pthread_mutex_destroy(&run_mutex_);
+  }
+
+
+  // the pool is created on first use
+  static worker_pool& instance()
+  {
+    static worker_pool pool;
+    return pool;
+  }
+
+
+  // true if the calling thread takes part in the actual run, as its owner or as a worker
+  bool is_nested()
+  {
+    const pthread_t self = pthread_self();
+    for (std::size_t i = 0U; i < threads_; ++i) {
+      if (pthread_equal(thread_[i], self)) {
+        return true;
+      }
+    }
+    pthread_mutex_lock(&mutex_);
+    const bool owner = running_ && pthread_equal(owner_, self);
+    pthread_mutex_unlock(&mutex_);
+    return owner;
+  }
+
+
+  // pass the jobs to the workers, take part and wait for the last job
+  void dispatch(std::size_t count, job_type job, void* context)
+  {
+    // one run at a time
+    pthread_mutex_lock(&run_mutex_);
+
+    pthread_mutex_lock(&mutex_);
+    owner_   = pthread_self();
+    running_ = true;
+    job_     = job;
+    context_ = context;
+    count_   = count;
+    next_    = 0U;
+    done_    = 0U;
+    generation_++;
+    pthread_cond_broadcast(&work_cond_);
+    execute();
+    while (done_ < count_) {
+      pthread_cond_wait(&done_cond_, &mutex_);
+    }
+    running_ = false;
+    pthread_mutex_unlock(&mutex_);
+
+    pthread_mutex_unlock(&run_mutex_);
+  }
+
+
+  // execute jobs until all are taken, mutex_ must be locked
+  void execute()
+  {
+    while (next_ < count_) {
+      const std::size_t index = next_++;
+      pthread_mutex_unlock(&mutex_);
+      job_(context_, index);
+      pthread_mutex_lock(&mutex_);
+      if (++done_ == count_) {
+        pthread_cond_signal(&done_cond_);
+      }
+    }
+  }
+
+
+  // worker thread
+  static void* worker(void* arg)
+  {
+    worker_pool& pool = *static_cast<worker_pool*>(arg);
+    std::size_t generation = 0U;
+    pthread_mutex_lock(&pool.mutex_);
+    for (;;) {
+      while (!pool.stop_ && (pool.generation_ == generation)) {
+        pthread_cond_wait(&pool.work_cond_, &pool.mutex_);
+      }
+      if (pool.stop_) {
+        break;
+      }
+      generation = pool.generation_;
+      pool.execute();
+    }
+    pthread_mutex_unlock(&pool.mutex_);
+    return nullptr;
+  }
+
+
+  job_type          job_;         // job of the actual run
+  void*             context_;     // context of the actual run
+  std::size_t       count_;       // number of jobs of the actual run
+  std::size_t       next_;        // next job to take
+  std::size_t       done_;        // number of finished jobs
+  std::size_t       generation_;  // run counter, wakes up the workers
+  std::size_t       threads_;     // number of started workers
+  bool              stop_;        // pool shutdown
+  bool              running_;     // a run is dispatched, owner_ is valid
+  pthread_t         owner_;       // thread which dispatched the actual run
+  pthread_mutex_t   run_mutex_;   // serializes the runs
+  pthread_mutex_t   mutex_;       // protects the run state
+  pthread_cond_t    work_cond_;   // signals a new run
+  pthread_cond_t    done_cond_;   // signals the last finished job
+  pthread_t         thread_[VIC_WORKER_POOL_THREADS];
+#endif  // VIC_WORKER_POOL_THREADS
+};
+
+} // namespace vic
+
+#endif  // _VIC_WORKER_POOL_H_
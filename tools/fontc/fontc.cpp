@@ -0,0 +1,975 @@
+///////////////////////////////////////////////////////////////////////////////
+// \author (c) Marco Paland (info@paland.com)
+//             2017-2017, PALANDesign Hannover, Germany
+//
+// \license The MIT License (MIT)
+//
+// This file is part of the vic library.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// \brief Font compiler, converts BDF bitmap fonts into vic font sources
+// This is a host tool (Linux), it is NOT part of the library and uses the STL.
+// Input is a BDF 2.1 font or a BDF 2.3 grayscale font (SIZE with 2, 4 or 8 bpp,
+// like the greymap BDF export of FontForge). Antialiased fonts can also be created
+// out of an oversampled bitmap font.
+// The output is deterministic (no time stamps), so generated fonts can be rebuilt
+// by the Makefile and compared.
+//
+// Usage:
+// fontc [options] font.bdf
+//   -n name       font symbol name, default: file name of the font
+//   -o path       output path and base file name, writes path.cpp and path.h
+//   -r first-last char range (hex with 0x prefix or decimal), repeatable, default: all chars
+//   -b bpp        output bits per pixel: 1, 2, 4 or 8, default: bpp of the font
+//   -s factor     oversampling factor of the font, factor x factor pixels form one output pixel
+//   -p            subpixel font, the BDF is rasterized at 3x horizontal resolution (e.g. otf2bdf -rh 216 -rv 72),
+//                 the output keeps 3 coverage samples per pixel for LCD stripe rendering (SUBPIXEL_3X)
+//   -e encoding   ascii or unicode, default: ascii if all chars are < 0x100
+//   -f format     mono, prop or rle, default: prop
+//   -w width      char width of mono fonts, default: max char distance
+//
+// Formats:
+// mono   mono_type,     fixed char cells, contiguous ASCII range
+// prop   prop_type (ASCII) or prop_ext_type (UNICODE), packed pixel rows
+// rle    prop_rle_type, compressed glyphs with tight boxes, best used together with the font index
+//        RLE pays off for antialiased and larger fonts, small 1 bpp fonts are smaller as packed rows
+//
+// Example:
+// fontc -n DejaVu_num_33x43_aa8_rle -b 8 -e unicode -f rle -o src/fonts/DejaVu_num_33x43_AA8_RLE src/fonts/bdf/DejaVu_num_33x43.bdf
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <getopt.h>
+
+
+namespace {
+
+
+// glyph in 8 bit coverage, coordinates are relative to the top/left corner of the char cell
+struct glyph_type
+{
+  std::uint32_t              code;
+  int                        xpos;    // x-start position in the cell
+  int                        ypos;    // y-start position in the cell
+  int                        xsize;
+  int                        ysize;
+  int                        xdist;   // x-distance (cursor movement)
+  int                        width;   // coverage samples per row, xsize or 3 * xsize for subpixel glyphs
+  std::vector<std::uint8_t>  coverage;
+
+  inline std::uint8_t pixel(int x, int y) const { return coverage[static_cast<std::size_t>(y * width + x)]; }
+};
+
+
+struct font_type
+{
+  std::string                          name;
+  std::string                          copyright;
+  int                                  ascent;
+  int                                  descent;
+  int                                  bpp;       // bits per pixel of the BDF bitmaps
+  std::map<std::uint32_t, glyph_type>  glyphs;
+};
+
+
+struct range_type
+{
+  std::uint32_t first;
+  std::uint32_t last;
+};
+
+
+struct options_type
+{
+  std::string              name;
+  std::string              output;
+  std::string              command;    // command line, stated in the generated files
+  std::vector<range_type>  ranges;
+  int                      bpp;
+  int                      oversample;
+  int                      samples;    // coverage samples per pixel, 3 for subpixel fonts
+  int                      width;
+  bool                     unicode;
+  bool                     encoding_set;
+  enum { format_mono, format_prop, format_rle } format;
+};
+
+
+void error(const char* msg, const char* arg = "")
+{
+  std::fprintf(stderr, "fontc: error: %s%s\n", msg, arg);
+  std::exit(1);
+}
+
+
+void warning(const char* msg, std::uint32_t code)
+{
+  std::fprintf(stderr, "fontc: warning: %s, char 0x%04X\n", msg, code);
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+// B D F   P A R S E R
+
+// returns the keyword value of a BDF line or nullptr if the line doesn't start with the keyword
+const char* bdf_keyword(const char* line, const char* keyword)
+{
+  const std::size_t len = std::strlen(keyword);
+  if (std::strncmp(line, keyword, len) || (line[len] && (line[len] != ' ') && (line[len] != '\t') && (line[len] != '\r') && (line[len] != '\n'))) {
+    return nullptr;
+  }
+  return line + len;
+}
+
+
+int hex_digit(char c)
+{
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  return -1;
+}
+
+
+void bdf_read(const char* file_name, font_type& font)
+{
+  FILE* f = std::fopen(file_name, "r");
+  if (!f) {
+    error("can't open ", file_name);
+  }
+
+  font.ascent  = -1;
+  font.descent = -1;
+  font.bpp     = 1;
+  int bbx_h = 0, bbx_y = 0;
+
+  char line[1024];
+  glyph_type g;
+  int dwidth = 0, w = 0, h = 0, xoff = 0, yoff = 0;
+  long encoding = -1;
+  while (std::fgets(line, sizeof(line), f)) {
+    const char* v;
+    if ((v = bdf_keyword(line, "FONT"))) {
+      char name[256] = { 0 };
+      std::sscanf(v, " %255s", name);
+      font.name = name;
+    }
+    else if ((v = bdf_keyword(line, "SIZE"))) {
+      int size, xres, yres, bpp = 1;
+      if (std::sscanf(v, "%d %d %d %d", &size, &xres, &yres, &bpp) == 4) {
+        font.bpp = bpp;
+      }
+      if ((font.bpp != 1) && (font.bpp != 2) && (font.bpp != 4) && (font.bpp != 8)) {
+        error("unsupported bpp of font ", file_name);
+      }
+    }
+    else if ((v = bdf_keyword(line, "FONTBOUNDINGBOX"))) {
+      int bbx_w, bbx_x;
+      std::sscanf(v, "%d %d %d %d", &bbx_w, &bbx_h, &bbx_x, &bbx_y);
+    }
+    else if ((v = bdf_keyword(line, "FONT_ASCENT"))) {
+      font.ascent = std::atoi(v);
+    }
+    else if ((v = bdf_keyword(line, "FONT_DESCENT"))) {
+      font.descent = std::atoi(v);
+    }
+    else if ((v = bdf_keyword(line, "COPYRIGHT"))) {
+      const char* s = std::strchr(v, '"');
+      const char* e = s ? std::strrchr(s + 1, '"') : nullptr;
+      if (s && e) {
+        font.copyright.assign(s + 1, e);
+      }
+    }
+    else if ((v = bdf_keyword(line, "STARTCHAR"))) {
+      encoding = -1;
+      dwidth = w = h = xoff = yoff = 0;
+    }
+    else if ((v = bdf_keyword(line, "ENCODING"))) {
+      encoding = std::atol(v);
+    }
+    else if ((v = bdf_keyword(line, "DWIDTH"))) {
+      dwidth = std::atoi(v);
+    }
+    else if ((v = bdf_keyword(line, "BBX"))) {
+      std::sscanf(v, "%d %d %d %d", &w, &h, &xoff, &yoff);
+    }
+    else if ((v = bdf_keyword(line, "BITMAP"))) {
+      if (font.ascent < 0) {
+        font.ascent  = bbx_h + bbx_y;
+        font.descent = -bbx_y;
+      }
+      g.code     = static_cast<std::uint32_t>(encoding);
+      g.xsize    = w;
+      g.width    = w;
+      g.ysize    = h;
+      g.xpos     = xoff;
+      g.ypos     = font.ascent - (yoff + h);
+      g.xdist    = dwidth;
+      g.coverage.assign(static_cast<std::size_t>(w * h), 0U);
+      const int max = (1 << font.bpp) - 1;
+      for (int y = 0; y < h; ++y) {
+        if (!std::fgets(line, sizeof(line), f)) {
+          error("unexpected end of file ", file_name);
+        }
+        for (int x = 0; x < w; ++x) {
+          const int bit   = x * font.bpp;
+          const int digit = hex_digit(line[bit / 4]);
+          if (digit < 0) {
+            error("invalid bitmap in ", file_name);
+          }
+          // bpp <= 4: the pixel is within the digit, bpp 8: two digits
+          const int value = (font.bpp == 8) ? ((digit << 4) | hex_digit(line[bit / 4 + 1])) : ((digit >> (4 - font.bpp - bit % 4)) & max);
+          g.coverage[static_cast<std::size_t>(y * w + x)] = static_cast<std::uint8_t>(value * 255 / max);
+        }
+      }
+      if (encoding >= 0) {
+        // chars with encoding -1 are not in the standard encoding and skipped
+        font.glyphs[g.code] = g;
+      }
+    }
+  }
+  std::fclose(f);
+
+  if (font.glyphs.empty()) {
+    error("no chars in font ", file_name);
+  }
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+// G L Y P H   P R O C E S S I N G
+
+// floor division for negative positions
+int floor_div(int a, int b)
+{
+  return (a >= 0) ? a / b : -((-a + b - 1) / b);
+}
+
+
+// downsample an oversampled glyph, the cell origin is kept on the output pixel grid
+glyph_type glyph_downsample(const glyph_type& src, int factor)
+{
+  glyph_type g;
+  g.code  = src.code;
+  g.xdist = (src.xdist + factor / 2) / factor;
+  if (!src.xsize || !src.ysize) {
+    g.xpos = g.ypos = g.xsize = g.ysize = g.width = 0;
+    return g;
+  }
+  g.xpos  = floor_div(src.xpos, factor);
+  g.ypos  = floor_div(src.ypos, factor);
+  g.xsize = floor_div(src.xpos + src.xsize - 1, factor) - g.xpos + 1;
+  g.ysize = floor_div(src.ypos + src.ysize - 1, factor) - g.ypos + 1;
+  g.width = g.xsize;
+  std::vector<int> sum(static_cast<std::size_t>(g.xsize * g.ysize), 0);
+  for (int y = 0; y < src.ysize; ++y) {
+    for (int x = 0; x < src.xsize; ++x) {
+      const int ox = floor_div(src.xpos + x, factor) - g.xpos;
+      const int oy = floor_div(src.ypos + y, factor) - g.ypos;
+      sum[static_cast<std::size_t>(oy * g.xsize + ox)] += src.pixel(x, y);
+    }
+  }
+  g.coverage.resize(sum.size());
+  for (std::size_t i = 0U; i < sum.size(); ++i) {
+    g.coverage[i] = static_cast<std::uint8_t>((sum[i] + factor * factor / 2) / (factor * factor));
+  }
+  return g;
+}
+
+
+// quantize the coverage to the output bpp (the coverage is then 0 - (2^bpp - 1)) and trim the glyph to its tight box
+void glyph_quantize(glyph_type& g, int bpp)
+{
+  const int max = (1 << bpp) - 1;
+  int x0 = g.xsize, y0 = g.ysize, x1 = -1, y1 = -1;
+  for (int y = 0; y < g.ysize; ++y) {
+    for (int x = 0; x < g.xsize; ++x) {
+      std::uint8_t& c = g.coverage[static_cast<std::size_t>(y * g.xsize + x)];
+      c = static_cast<std::uint8_t>((c * max + 127) / 255);
+      if (c) {
+        x0 = x < x0 ? x : x0;  x1 = x > x1 ? x : x1;
+        y0 = y < y0 ? y : y0;  y1 = y > y1 ? y : y1;
+      }
+    }
+  }
+  if (x1 < 0) {
+    // blank char
+    g.xpos = g.ypos = g.xsize = g.ysize = g.width = 0;
+    g.coverage.clear();
+    return;
+  }
+  std::vector<std::uint8_t> tight;
+  for (int y = y0; y <= y1; ++y) {
+    for (int x = x0; x <= x1; ++x) {
+      tight.push_back(g.pixel(x, y));
+    }
+  }
+  g.xpos    += x0;
+  g.ypos    += y0;
+  g.xsize    = x1 - x0 + 1;
+  g.ysize    = y1 - y0 + 1;
+  g.width    = g.xsize;
+  g.coverage = tight;
+}
+
+
+// align a glyph of 3x horizontal resolution to the pixel grid, the metrics are converted to pixel
+// and the coverage keeps 3 samples per pixel
+void glyph_subpixel(glyph_type& g)
+{
+  g.xdist = (g.xdist + 1) / 3;
+  if (!g.xsize) {
+    // blank char
+    return;
+  }
+  const int x0    = floor_div(g.xpos, 3);
+  const int x1    = floor_div(g.xpos + g.xsize - 1, 3);
+  const int width = (x1 - x0 + 1) * 3;
+  const int shift = g.xpos - x0 * 3;
+  std::vector<std::uint8_t> aligned(static_cast<std::size_t>(width * g.ysize), 0U);
+  for (int y = 0; y < g.ysize; ++y) {
+    for (int x = 0; x < g.xsize; ++x) {
+      aligned[static_cast<std::size_t>(y * width + shift + x)] = g.pixel(x, y);
+    }
+  }
+  g.xpos     = x0;
+  g.xsize    = x1 - x0 + 1;
+  g.width    = width;
+  g.coverage = aligned;
+}
+
+
+// render the glyph into a cell of the given size (width in samples), pixels outside the cell are clipped
+std::vector<std::uint8_t> glyph_cell(const glyph_type& g, int width, int height, int samples)
+{
+  std::vector<std::uint8_t> cell(static_cast<std::size_t>(width * height), 0U);
+  bool clipped = false;
+  for (int y = 0; y < g.ysize; ++y) {
+    for (int x = 0; x < g.width; ++x) {
+      const int cx = g.xpos * samples + x, cy = g.ypos + y;
+      if ((cx < 0) || (cy < 0) || (cx >= width) || (cy >= height)) {
+        clipped = clipped || g.pixel(x, y);
+        continue;
+      }
+      cell[static_cast<std::size_t>(cy * width + cx)] = g.pixel(x, y);
+    }
+  }
+  if (clipped) {
+    warning("glyph exceeds the char cell and is clipped", g.code);
+  }
+  return cell;
+}
+
+
+// pack pixel rows, MSB first
+std::vector<std::uint8_t> pack_rows(const std::vector<std::uint8_t>& pixels, int width, int height, int bpp)
+{
+  const int bytes_per_line = (width * bpp + 7) / 8;
+  std::vector<std::uint8_t> data(static_cast<std::size_t>(bytes_per_line * height), 0U);
+  for (int y = 0; y < height; ++y) {
+    for (int x = 0; x < width; ++x) {
+      const int bit = x * bpp;
+      data[static_cast<std::size_t>(y * bytes_per_line + bit / 8)] |= static_cast<std::uint8_t>(pixels[static_cast<std::size_t>(y * width + x)] << (8 - bpp - bit % 8));
+    }
+  }
+  return data;
+}
+
+
+// RLE encoding of a tight glyph, see font::rle_run()
+std::vector<std::uint8_t> pack_rle(const glyph_type& g, int bpp)
+{
+  const int max_run = (bpp == 8) ? 256 : (1 << (8 - bpp));
+  std::vector<std::uint8_t> data;
+  for (int y = 0; y < g.ysize; ++y) {
+    for (int x = 0; x < g.width; ) {
+      const std::uint8_t c = g.pixel(x, y);
+      int n = 1;
+      while ((x + n < g.width) && (n < max_run) && (g.pixel(x + n, y) == c)) {
+        ++n;
+      }
+      if (bpp == 8) {
+        data.push_back(static_cast<std::uint8_t>(n - 1));
+        data.push_back(c);
+      }
+      else {
+        data.push_back(static_cast<std::uint8_t>(((n - 1) << bpp) | c));
+      }
+      x += n;
+    }
+  }
+  return data;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+// O U T P U T
+
+class writer
+{
+public:
+  writer() { }
+
+  void printf(const char* format, ...) __attribute__((format(printf, 2, 3)))
+  {
+    char buf[1024];
+    va_list args;
+    va_start(args, format);
+    std::vsnprintf(buf, sizeof(buf), format, args);
+    va_end(args);
+    text_ += buf;
+  }
+
+  // struct member with aligned comment
+  void field(bool first, const std::string& value, const char* comment)
+  {
+    // long values keep a gap to the comment
+    const int width = (value.size() < 39U) ? 40 : static_cast<int>(value.size()) + 2;
+    printf("  %c%-*s// %s\n", first ? ' ' : ',', width, value.c_str(), comment);
+  }
+
+  // write the file, the line endings are CRLF like all library sources
+  void save(const std::string& file_name) const
+  {
+    FILE* f = std::fopen(file_name.c_str(), "wb");
+    if (!f) {
+      error("can't create ", file_name.c_str());
+    }
+    for (std::string::const_iterator it = text_.begin(); it != text_.end(); ++it) {
+      if (*it == '\n') {
+        std::fputc('\r', f);
+      }
+      std::fputc(*it, f);
+    }
+    std::fclose(f);
+  }
+
+private:
+  std::string text_;
+};
+
+
+void write_header_block(writer& w, const options_type& opt, const font_type& font, const std::string& brief)
+{
+  w.printf("///////////////////////////////////////////////////////////////////////////////\n");
+  w.printf("// \\license The MIT License (MIT)\n");
+  w.printf("//\n");
+  w.printf("// This file is part of the vic library.\n");
+  w.printf("// Permission is hereby granted, free of charge, to any person obtaining a copy\n");
+  w.printf("// of this software and associated documentation files (the \"Software\"), to deal\n");
+  w.printf("// in the Software without restriction, including without limitation the rights\n");
+  w.printf("// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell\n");
+  w.printf("// copies of the Software, and to permit persons to whom the Software is\n");
+  w.printf("// furnished to do so, subject to the following conditions:\n");
+  w.printf("//\n");
+  w.printf("// The above copyright notice and this permission notice shall be included in\n");
+  w.printf("// all copies or substantial portions of the Software.\n");
+  w.printf("//\n");
+  w.printf("// THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR\n");
+  w.printf("// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,\n");
+  w.printf("// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE\n");
+  w.printf("// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER\n");
+  w.printf("// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,\n");
+  w.printf("// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN\n");
+  w.printf("// THE SOFTWARE.\n");
+  w.printf("//\n");
+  w.printf("// \\brief %s\n", brief.c_str());
+  w.printf("// Font: %s\n", font.name.c_str());
+  if (!font.copyright.empty()) {
+    w.printf("// Copyright of the font: %s\n", font.copyright.c_str());
+  }
+  w.printf("//\n");
+  w.printf("// Generated by the vic font compiler - DO NOT EDIT\n");
+  w.printf("// %s\n", opt.command.c_str());
+  w.printf("//\n");
+  w.printf("///////////////////////////////////////////////////////////////////////////////\n\n");
+}
+
+
+void write_bytes(writer& w, const std::vector<std::uint8_t>& data, std::size_t begin, std::size_t end, std::size_t per_line, bool last)
+{
+  for (std::size_t i = begin; i < end; ++i) {
+    if (!((i - begin) % per_line)) {
+      w.printf("  ");
+    }
+    w.printf("0x%02X%s", data[i], ((i + 1U == end) && last) ? "" : ",");
+    w.printf("%s", (((i - begin) % per_line == per_line - 1U) || (i + 1U == end)) ? "\n" : " ");
+  }
+}
+
+
+// split the chars into ranges, small gaps are filled with blank chars
+std::vector<range_type> char_ranges(const std::map<std::uint32_t, glyph_type>& glyphs)
+{
+  std::vector<range_type> ranges;
+  for (std::map<std::uint32_t, glyph_type>::const_iterator it = glyphs.begin(); it != glyphs.end(); ++it) {
+    if (!ranges.empty() && (it->first - ranges.back().last <= 2U)) {
+      ranges.back().last = it->first;
+    }
+    else {
+      range_type r = { it->first, it->first };
+      ranges.push_back(r);
+    }
+  }
+  return ranges;
+}
+
+
+const glyph_type* glyph_find(const std::map<std::uint32_t, glyph_type>& glyphs, std::uint32_t code)
+{
+  std::map<std::uint32_t, glyph_type>::const_iterator it = glyphs.find(code);
+  return (it != glyphs.end()) ? &it->second : nullptr;
+}
+
+
+std::string format(const char* format, ...)
+{
+  char buf[256];
+  va_list args;
+  va_start(args, format);
+  std::vsnprintf(buf, sizeof(buf), format, args);
+  va_end(args);
+  return buf;
+}
+
+
+std::string font_attr(const options_type& opt, const char* type)
+{
+  static const char* const aa[] = { "", "AA_NONE", "AA_2", "", "AA_4", "", "", "", "AA_8" };
+  return std::string(opt.unicode ? "ENCODING_UNICODE" : "ENCODING_ASCII") + " | " + aa[opt.bpp] + " | " + type + ((opt.samples > 1) ? " | SUBPIXEL_3X" : "");
+}
+
+
+void write_font_type(writer& w, const options_type& opt, const font_type& font, const std::string& attr, const std::string& ptr)
+{
+  const int height = font.ascent + font.descent;
+  w.printf("const font_type %s = {\n", opt.name.c_str());
+  w.field(true, attr, "type of font");
+  w.field(false, format("%dU", height), "height of font");
+  w.field(false, format("%dU", height), "y space of font");
+  w.field(false, format("%dU", font.ascent), "baseline");
+  w.field(false, "&" + ptr, "font data");
+  w.printf("};\n\n");
+}
+
+
+void write_mono(writer& w, const options_type& opt, const font_type& font)
+{
+  const std::uint32_t first = font.glyphs.begin()->first;
+  const std::uint32_t last  = font.glyphs.rbegin()->first;
+  const int height = font.ascent + font.descent;
+  int width = opt.width;
+  for (std::map<std::uint32_t, glyph_type>::const_iterator it = font.glyphs.begin(); !opt.width && (it != font.glyphs.end()); ++it) {
+    width = it->second.xdist > width ? it->second.xdist : width;
+  }
+  const int bytes_per_line = (width * opt.samples * opt.bpp + 7) / 8;
+
+  w.printf("static const std::uint8_t %s_data[] = {\n", opt.name.c_str());
+  glyph_type blank = { 0U, 0, 0, 0, 0, 0, 0, std::vector<std::uint8_t>() };
+  for (std::uint32_t code = first; code <= last; ++code) {
+    const glyph_type* g = glyph_find(font.glyphs, code);
+    const std::vector<std::uint8_t> data = pack_rows(glyph_cell(g ? *g : blank, width * opt.samples, height, opt.samples), width * opt.samples, height, opt.bpp);
+    write_bytes(w, data, 0U, data.size(), data.size(), code == last);
+  }
+  w.printf("};\n\n");
+
+  w.printf("static const mono_type %s_mono = {\n", opt.name.c_str());
+  w.printf("  0x%02XU,\n", first);
+  w.printf("  0x%02XU,\n", last);
+  w.printf("  %dU,\n", width);
+  w.printf("  %dU,\n", bytes_per_line);
+  w.printf("  %s_data\n", opt.name.c_str());
+  w.printf("};\n\n");
+
+  write_font_type(w, opt, font, font_attr(opt, "TYPE_MONO"), opt.name + "_mono");
+}
+
+
+void write_prop(writer& w, const options_type& opt, const font_type& font)
+{
+  const int height = font.ascent + font.descent;
+  const std::vector<range_type> ranges = char_ranges(font.glyphs);
+
+  // glyph data
+  for (std::map<std::uint32_t, glyph_type>::const_iterator it = font.glyphs.begin(); it != font.glyphs.end(); ++it) {
+    const glyph_type& g = it->second;
+    std::vector<std::uint8_t> data;
+    int bytes_per_line;
+    if (opt.unicode) {
+      // extended char info, tight glyph box
+      data           = pack_rows(g.coverage, g.width, g.ysize, opt.bpp);
+      bytes_per_line = (g.width * opt.bpp + 7) / 8;
+    }
+    else {
+      // standard char info, full cell height starting at x = 0
+      const int width = (g.xpos + g.xsize > g.xdist) ? g.xpos + g.xsize : g.xdist;
+      data           = pack_rows(glyph_cell(g, width * opt.samples, height, opt.samples), width * opt.samples, height, opt.bpp);
+      bytes_per_line = (width * opt.samples * opt.bpp + 7) / 8;
+    }
+    if (data.empty()) {
+      continue;
+    }
+    w.printf("static const std::uint8_t %s_%04X[] = { /* code %04X */\n", opt.name.c_str(), g.code, g.code);
+    write_bytes(w, data, 0U, data.size(), static_cast<std::size_t>(bytes_per_line), true);
+    w.printf("};\n\n");
+  }
+
+  // char info
+  std::size_t count = 0U;
+  for (std::size_t r = 0U; r < ranges.size(); ++r) {
+    count += ranges[r].last - ranges[r].first + 1U;
+  }
+  w.printf("static const %s %s_charinfo[%u] = {\n", opt.unicode ? "charinfo_ext_type" : "charinfo_type", opt.name.c_str(), static_cast<unsigned>(count));
+  std::vector<std::size_t> range_index;
+  count = 0U;
+  for (std::size_t r = 0U; r < ranges.size(); ++r) {
+    range_index.push_back(count);
+    for (std::uint32_t code = ranges[r].first; code <= ranges[r].last; ++code, ++count) {
+      const glyph_type* g = glyph_find(font.glyphs, code);
+      char data[64] = "nullptr";
+      if (g && (opt.unicode ? (g->xsize > 0) : true)) {
+        std::snprintf(data, sizeof(data), "%s_%04X", opt.name.c_str(), code);
+      }
+      w.printf("  %s", count ? "," : " ");
+      if (opt.unicode) {
+        w.printf("{ %3d, %3d, %4d, %4d, %3d, %s }", g ? g->xsize : 0, g ? g->ysize : 0, g ? g->xpos : 0, g ? g->ypos : 0, g ? g->xdist : 0, data);
+      }
+      else {
+        const int width = g ? ((g->xpos + g->xsize > g->xdist) ? g->xpos + g->xsize : g->xdist) : 0;
+        w.printf("{ %3d, %3d, %2d, %s }", width, g ? g->xdist : 0, (width * opt.samples * opt.bpp + 7) / 8, data);
+      }
+      w.printf(" /* code %04X */\n", code);
+    }
+  }
+  w.printf("};\n\n");
+
+  // ranges, last first so that the next pointers are defined
+  const char* type = opt.unicode ? "prop_ext_type" : "prop_type";
+  for (std::size_t r = ranges.size(); r--; ) {
+    w.printf("static const %s %s_prop%u = {\n", type, opt.name.c_str(), static_cast<unsigned>(r + 1U));
+    w.field(true, format("0x%02XU", ranges[r].first), "first character");
+    w.field(false, format("0x%02XU", ranges[r].last), "last character");
+    w.field(false, format("&%s_charinfo[%uU]", opt.name.c_str(), static_cast<unsigned>(range_index[r])), "address of first character");
+    if (r + 1U < ranges.size()) {
+      w.field(false, format("&%s_prop%u", opt.name.c_str(), static_cast<unsigned>(r + 2U)), "pointer to next range");
+    }
+    else {
+      w.field(false, "nullptr", "pointer to next range");
+    }
+    w.printf("};\n\n");
+  }
+
+  write_font_type(w, opt, font, font_attr(opt, "TYPE_PROP"), opt.name + "_prop1");
+}
+
+
+void write_rle(writer& w, const options_type& opt, const font_type& font)
+{
+  std::vector<range_type> ranges = char_ranges(font.glyphs);
+
+  // the stream offset is 16 bit, split ranges with more glyph data
+  std::vector<range_type> split;
+  for (std::size_t r = 0U; r < ranges.size(); ++r) {
+    range_type cur = { ranges[r].first, ranges[r].first };
+    std::size_t size = 0U;
+    for (std::uint32_t code = ranges[r].first; code <= ranges[r].last; ++code) {
+      const glyph_type* g = glyph_find(font.glyphs, code);
+      const std::size_t glyph_size = g ? pack_rle(*g, opt.bpp).size() : 0U;
+      if (size + glyph_size > 0xFFFFU) {
+        split.push_back(cur);
+        cur.first = code;
+        size = 0U;
+      }
+      cur.last = code;
+      size += glyph_size;
+    }
+    split.push_back(cur);
+  }
+  ranges = split;
+
+  std::size_t raw_size = 0U, rle_size = 0U;
+  std::vector<bool> has_data;
+  for (std::size_t r = 0U; r < ranges.size(); ++r) {
+    // RLE streams of the range
+    std::vector<std::uint8_t> data;
+    std::vector<std::size_t>  offset;
+    for (std::uint32_t code = ranges[r].first; code <= ranges[r].last; ++code) {
+      const glyph_type* g = glyph_find(font.glyphs, code);
+      offset.push_back(data.size());
+      if (g) {
+        const std::vector<std::uint8_t> stream = pack_rle(*g, opt.bpp);
+        data.insert(data.end(), stream.begin(), stream.end());
+        raw_size += static_cast<std::size_t>((g->width * opt.bpp + 7) / 8 * g->ysize);
+      }
+    }
+    offset.push_back(data.size());
+    rle_size += data.size();
+    has_data.push_back(!data.empty());
+
+    if (!data.empty()) {
+      w.printf("static const std::uint8_t %s_data%u[] = {\n", opt.name.c_str(), static_cast<unsigned>(r + 1U));
+      for (std::uint32_t code = ranges[r].first; code <= ranges[r].last; ++code) {
+        const std::size_t i = code - ranges[r].first;
+        if (offset[i] != offset[i + 1U]) {
+          w.printf("  /* code %04X */\n", code);
+          write_bytes(w, data, offset[i], offset[i + 1U], 16U, offset[i + 1U] == data.size());
+        }
+      }
+      w.printf("};\n\n");
+    }
+
+    w.printf("static const charinfo_rle_type %s_charinfo%u[%u] = {\n", opt.name.c_str(), static_cast<unsigned>(r + 1U), static_cast<unsigned>(ranges[r].last - ranges[r].first + 1U));
+    for (std::uint32_t code = ranges[r].first; code <= ranges[r].last; ++code) {
+      const glyph_type* g = glyph_find(font.glyphs, code);
+      w.printf("  %s{ %3d, %3d, %4d, %4d, %3d, 0, %5uU }", (code == ranges[r].first) ? " " : ",",
+               g ? g->xsize : 0, g ? g->ysize : 0, g ? g->xpos : 0, g ? g->ypos : 0, g ? g->xdist : 0,
+               static_cast<unsigned>(offset[code - ranges[r].first]));
+      w.printf(" /* code %04X */\n", code);
+    }
+    w.printf("};\n\n");
+  }
+
+  for (std::size_t r = ranges.size(); r--; ) {
+    w.printf("static const prop_rle_type %s_prop%u = {\n", opt.name.c_str(), static_cast<unsigned>(r + 1U));
+    w.field(true, format("0x%04XU", ranges[r].first), "first character");
+    w.field(false, format("0x%04XU", ranges[r].last), "last character");
+    w.field(false, format("%s_charinfo%u", opt.name.c_str(), static_cast<unsigned>(r + 1U)), "char info of the range");
+    if (has_data[r]) {
+      w.field(false, format("%s_data%u", opt.name.c_str(), static_cast<unsigned>(r + 1U)), "RLE streams of the range");
+    }
+    else {
+      w.field(false, "nullptr", "RLE streams of the range");
+    }
+    if (r + 1U < ranges.size()) {
+      w.field(false, format("&%s_prop%u", opt.name.c_str(), static_cast<unsigned>(r + 2U)), "pointer to next range");
+    }
+    else {
+      w.field(false, "nullptr", "pointer to next range");
+    }
+    w.printf("};\n\n");
+  }
+
+  write_font_type(w, opt, font, font_attr(opt, "TYPE_PROP | FORMAT_RLE"), opt.name + "_prop1");
+
+  if (ranges.size() > 64U) {
+    std::fprintf(stderr, "fontc: warning: %u ranges, increase VIC_FONT_INDEX_RANGES for indexed lookup\n", static_cast<unsigned>(ranges.size()));
+  }
+  std::fprintf(stderr, "fontc: %s: %u bytes packed rows, %u bytes RLE\n", opt.name.c_str(), static_cast<unsigned>(raw_size), static_cast<unsigned>(rle_size));
+  if (rle_size > raw_size) {
+    std::fprintf(stderr, "fontc: warning: %s: RLE is larger than packed rows, use '-f prop' for this font\n", opt.name.c_str());
+  }
+}
+
+
+void write_font(const options_type& opt, const font_type& font)
+{
+  // file name without path
+  std::string file = opt.output;
+  const std::size_t slash = file.find_last_of('/');
+  if (slash != std::string::npos) {
+    file = file.substr(slash + 1U);
+  }
+  std::string guard = "_VIC_FONT_";
+  for (std::size_t i = 0U; i < file.size(); ++i) {
+    guard += static_cast<char>(((file[i] >= 'a') && (file[i] <= 'z')) ? file[i] - 'a' + 'A' : file[i]);
+  }
+  guard += "_H_";
+
+  char brief[256];
+  std::snprintf(brief, sizeof(brief), "%s font %d, %d bpp%s, chars 0x%02X - 0x%02X",
+                (opt.format == options_type::format_mono) ? "Mono" : ((opt.format == options_type::format_rle) ? "RLE compressed" : "Prop"),
+                font.ascent + font.descent, opt.bpp, (opt.samples > 1) ? " subpixel" : "", font.glyphs.begin()->first, font.glyphs.rbegin()->first);
+
+  // header
+  writer h;
+  write_header_block(h, opt, font, brief);
+  h.printf("#ifndef %s\n", guard.c_str());
+  h.printf("#define %s\n\n", guard.c_str());
+  h.printf("#include \"../font.h\"\n\n\n");
+  h.printf("namespace vic {\nnamespace font {\n\n");
+  h.printf("extern const font_type %s;\n\n", opt.name.c_str());
+  h.printf("} // namespace font\n} // namespace vic\n\n");
+  h.printf("#endif  // %s\n", guard.c_str());
+  h.save(opt.output + ".h");
+
+  // source
+  writer c;
+  write_header_block(c, opt, font, brief);
+  c.printf("#include \"%s.h\"\n\n\n", file.c_str());
+  c.printf("namespace vic {\nnamespace font {\n\n");
+  switch (opt.format) {
+    case options_type::format_mono : write_mono(c, opt, font); break;
+    case options_type::format_prop : write_prop(c, opt, font); break;
+    case options_type::format_rle  : write_rle(c, opt, font);  break;
+  }
+  c.printf("} // namespace font\n} // namespace vic\n");
+  c.save(opt.output + ".cpp");
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+// M A I N
+
+void usage()
+{
+  std::fprintf(stderr,
+    "usage: fontc [options] font.bdf\n"
+    "  -n name       font symbol name, default: file name of the font\n"
+    "  -o path       output path and base file name, writes path.cpp and path.h\n"
+    "  -r first-last char range, repeatable, default: all chars\n"
+    "  -b bpp        output bits per pixel: 1, 2, 4 or 8, default: bpp of the font\n"
+    "  -s factor     oversampling factor of the font\n"
+    "  -p            subpixel font, the BDF has 3x horizontal resolution\n"
+    "  -e encoding   ascii or unicode\n"
+    "  -f format     mono, prop or rle, default: prop\n"
+    "  -w width      char width of mono fonts\n");
+  std::exit(1);
+}
+
+
+} // namespace
+
+
+int main(int argc, char* argv[])
+{
+  options_type opt;
+  opt.bpp          = 0;
+  opt.oversample   = 1;
+  opt.samples      = 1;
+  opt.width        = 0;
+  opt.unicode      = false;
+  opt.encoding_set = false;
+  opt.format       = options_type::format_prop;
+  opt.command      = "fontc";
+  for (int i = 1; i < argc; ++i) {
+    opt.command += std::string(" ") + argv[i];
+  }
+
+  int c;
+  while ((c = getopt(argc, argv, "n:o:r:b:s:pe:f:w:")) != -1) {
+    switch (c) {
+      case 'n' : opt.name   = optarg; break;
+      case 'o' : opt.output = optarg; break;
+      case 'r' : {
+        char* end;
+        range_type r;
+        r.first = static_cast<std::uint32_t>(std::strtoul(optarg, &end, 0));
+        r.last  = (*end == '-') ? static_cast<std::uint32_t>(std::strtoul(end + 1, &end, 0)) : r.first;
+        if (*end || (r.last < r.first)) {
+          error("invalid range ", optarg);
+        }
+        opt.ranges.push_back(r);
+        break;
+      }
+      case 'b' : opt.bpp        = std::atoi(optarg); break;
+      case 's' : opt.oversample = std::atoi(optarg); break;
+      case 'p' : opt.samples    = 3; break;
+      case 'w' : opt.width      = std::atoi(optarg); break;
+      case 'e' :
+        opt.encoding_set = true;
+        if (!std::strcmp(optarg, "unicode")) opt.unicode = true;
+        else if (std::strcmp(optarg, "ascii")) error("invalid encoding ", optarg);
+        break;
+      case 'f' :
+        if (!std::strcmp(optarg, "mono"))      opt.format = options_type::format_mono;
+        else if (!std::strcmp(optarg, "prop")) opt.format = options_type::format_prop;
+        else if (!std::strcmp(optarg, "rle"))  opt.format = options_type::format_rle;
+        else error("invalid format ", optarg);
+        break;
+      default :
+        usage();
+    }
+  }
+  if (optind + 1 != argc) {
+    usage();
+  }
+  if ((opt.bpp != 0) && (opt.bpp != 1) && (opt.bpp != 2) && (opt.bpp != 4) && (opt.bpp != 8)) {
+    error("invalid bpp, use 1, 2, 4 or 8");
+  }
+  if (opt.oversample < 1) {
+    error("invalid oversampling factor");
+  }
+
+  // default names out of the font file name
+  std::string base = argv[optind];
+  base = base.substr(base.find_last_of('/') == std::string::npos ? 0U : base.find_last_of('/') + 1U);
+  base = base.substr(0U, base.find_last_of('.'));
+  if (opt.name.empty())   opt.name   = base;
+  if (opt.output.empty()) opt.output = base;
+
+  font_type font;
+  bdf_read(argv[optind], font);
+  if (!opt.bpp) {
+    // an oversampled bitmap font gets antialiased
+    opt.bpp = (opt.oversample > 1) ? 4 : font.bpp;
+  }
+
+  // select and process the chars
+  std::map<std::uint32_t, glyph_type> glyphs;
+  for (std::map<std::uint32_t, glyph_type>::iterator it = font.glyphs.begin(); it != font.glyphs.end(); ++it) {
+    bool selected = opt.ranges.empty();
+    for (std::size_t r = 0U; r < opt.ranges.size(); ++r) {
+      selected = selected || ((it->first >= opt.ranges[r].first) && (it->first <= opt.ranges[r].last));
+    }
+    if (!selected) {
+      continue;
+    }
+    glyph_type g = (opt.oversample > 1) ? glyph_downsample(it->second, opt.oversample) : it->second;
+    glyph_quantize(g, opt.bpp);
+    if (opt.samples > 1) {
+      glyph_subpixel(g);
+    }
+    glyphs[g.code] = g;
+  }
+  if (glyphs.empty()) {
+    error("no chars in the selected ranges");
+  }
+  font.glyphs = glyphs;
+  if (opt.oversample > 1) {
+    font.ascent  = (font.ascent  + opt.oversample - 1) / opt.oversample;
+    font.descent = (font.descent + opt.oversample - 1) / opt.oversample;
+  }
+
+  // encoding
+  const std::uint32_t last = font.glyphs.rbegin()->first;
+  if (!opt.encoding_set) {
+    opt.unicode = (last > 0xFFU) && (opt.format != options_type::format_mono);
+  }
+  if ((!opt.unicode && (last > 0xFFU)) || (last > 0x10FFFFU)) {
+    error("chars exceed the encoding, select a smaller range");
+  }
+  if ((opt.format == options_type::format_mono) && opt.unicode) {
+    error("mono fonts support ASCII encoding only");
+  }
+  if (font.ascent + font.descent > 0xFF) {
+    error("font height exceeds 255 pixel");
+  }
+
+  write_font(opt, font);
+  return 0;
+}